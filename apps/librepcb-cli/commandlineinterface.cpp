@@ -124,6 +124,11 @@ int CommandLineInterface::execute() noexcept {
          "containing custom settings. If not set, the settings from the boards "
          "will be used instead."),
       tr("file"));
+  QCommandLineOption jobsOption(
+      "jobs",
+      tr("Number of files to generate in parallel when exporting PCB "
+         "fabrication data. If not set, the number of CPU cores is used."),
+      tr("count"));
   QCommandLineOption boardOption("board",
                                  tr("The name of the board(s) to export. Can "
                                     "be given multiple times. If not set, "
@@ -176,6 +181,7 @@ int CommandLineInterface::execute() noexcept {
     parser.addOption(bomAttributesOption);
     parser.addOption(exportPcbFabricationDataOption);
     parser.addOption(pcbFabricationSettingsOption);
+    parser.addOption(jobsOption);
     parser.addOption(boardOption);
     parser.addOption(saveOption);
     parser.addOption(prjStrictOption);
@@ -236,6 +242,18 @@ int CommandLineInterface::execute() noexcept {
       print(parser.helpText(), 0);
       return 1;
     }
+    int jobs = 0;  // use all CPU cores
+    if (parser.isSet(jobsOption)) {
+      bool ok = false;
+      jobs = parser.value(jobsOption).toInt(&ok);
+      if ((!ok) || (jobs < 1)) {
+        printErr(tr("Invalid value for option '%1': %2")
+                     .arg("--jobs", parser.value(jobsOption)),
+                 2);
+        print(parser.helpText(), 0);
+        return 1;
+      }
+    }
     cmdSuccess = openProject(
         positionalArgs.value(0),  // project filepath
         parser.isSet(ercOption),  // run ERC
@@ -245,6 +263,7 @@ int CommandLineInterface::execute() noexcept {
         parser.value(bomAttributesOption),  // BOM attributes
         parser.isSet(exportPcbFabricationDataOption),  // export PCB fab. data
         parser.value(pcbFabricationSettingsOption),  // PCB fab. settings
+        jobs,  // PCB fab. parallel jobs
         parser.values(boardOption),  // boards
         parser.isSet(saveOption),  // save project
         parser.isSet(prjStrictOption)  // strict mode
@@ -281,7 +300,8 @@ bool CommandLineInterface::openProject(
     const QStringList& exportSchematicsFiles, const QStringList& exportBomFiles,
     const QStringList& exportBoardBomFiles, const QString& bomAttributes,
     bool exportPcbFabricationData, const QString& pcbFabricationSettingsPath,
-    const QStringList& boards, bool save, bool strict) const noexcept {
+    int jobs, const QStringList& boards, bool save, bool strict) const
+    noexcept {
   try {
     bool success = true;
     QMap<FilePath, int> writtenFilesCounter;
@@ -491,7 +511,7 @@ bool CommandLineInterface::openProject(
             *board,
             customSettings ? *customSettings
                            : board->getFabricationOutputSettings());
-        grbExport.exportAllLayers();  // can throw
+        grbExport.exportAllLayers(jobs);  // can throw
         foreach (const FilePath& fp, grbExport.getWrittenFiles()) {
           print(QString("    => '%1'").arg(prettyPath(fp, projectFile)));
           writtenFilesCounter[fp]++;
@@ -65,7 +65,7 @@ private:  // Methods
                    const QStringList& exportBomFiles,
                    const QStringList& exportBoardBomFiles,
                    const QString& bomAttributes, bool exportPcbFabricationData,
-                   const QString& pcbFabricationSettingsPath,
+                   const QString& pcbFabricationSettingsPath, int jobs,
                    const QStringList& boards, bool save, bool strict) const
       noexcept;
   bool openLibrary(const QString& libDir, bool all, bool save,
@@ -22,6 +22,10 @@
  ******************************************************************************/
 #include "airwiresbuilder.h"
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <unordered_map>
 
 #include <QtCore>
@@ -35,7 +39,7 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-AirWiresBuilder::AirWiresBuilder() noexcept {
+AirWiresBuilder::AirWiresBuilder() noexcept : mIsBuilt(false) {
 }
 
 AirWiresBuilder::~AirWiresBuilder() noexcept {
@@ -46,149 +50,366 @@ AirWiresBuilder::~AirWiresBuilder() noexcept {
  ******************************************************************************/
 
 int AirWiresBuilder::addPoint(const Point& p) noexcept {
-  int id = mPoints.size();
-  mPoints.emplace_back(p.getX().toNm(), p.getY().toNm(), id);
+  applyRemovals();
+  int id;
+  if (mFreeIds.empty()) {
+    id = mPoints.size();
+    mPoints.push_back(Node{p.getX().toNm(), p.getY().toNm()});
+    mRemoved.push_back(false);
+    mParents.push_back(id);
+  } else {
+    id = mFreeIds.back();
+    mFreeIds.pop_back();
+    mPoints[id] = Node{p.getX().toNm(), p.getY().toNm()};
+    mRemoved[id] = false;
+    mParents[id] = id;
+  }
+  if (mIsBuilt) {
+    insertPointIntoMst(id);
+  }
   return id;
 }
 
+void AirWiresBuilder::removePoint(int id) noexcept {
+  Q_ASSERT(!mRemoved[id]);
+  mRemoved[id] = true;
+  mRemovedIds.push_back(id);
+}
+
 void AirWiresBuilder::addEdge(int p1, int p2) noexcept {
-  mEdges.emplace_back(mPoints[p1], mPoints[p2], -1);
+  applyRemovals();
+  mEdges.insert(std::make_pair(qMin(p1, p2), qMax(p1, p2)));
+  if (mIsBuilt) {
+    insertEdgeIntoMst(p1, p2);
+  }
 }
 
 AirWiresBuilder::AirWires AirWiresBuilder::buildAirWires() noexcept {
-  // remember how many edges are already known as connected
-  uint connectedEdges = mEdges.size();
-
-  // determine additional edges between found points (candidates for airwires)
-  if (mPoints.size() == 2) {
-    mEdges.emplace_back(mPoints[0], mPoints[1], -1);
-  } else if (mPoints.size() == 3) {
-    // manually triangulate since it is easy and more stable than the
-    // delaunay-triangulation library
-    mEdges.emplace_back(mPoints[0], mPoints[1], -1);
-    mEdges.emplace_back(mPoints[1], mPoints[2], -1);
-    mEdges.emplace_back(mPoints[2], mPoints[0], -1);
-  } else if (mPoints.size() >= 3) {
-    // since delaunay-triangulation sometimes doesn't work well, add fallback
-    // edges to make sure at least all points are connected somehow
-    for (std::size_t i = 1; i < mPoints.size(); ++i) {
-      mEdges.emplace_back(mPoints[i - 1], mPoints[i], -1);
+  applyRemovals();
+  if (!mIsBuilt) {
+    // merge the connected points into subsets
+    for (const auto& edge : mEdges) {
+      int root1 = findRoot(mParents, edge.first);
+      int root2 = findRoot(mParents, edge.second);
+      if (root1 != root2) {
+        mParents[root2] = root1;
+      }
     }
 
-    // now run delaunay triangulation to add additional edges
-    delaunay::Delaunay<qreal> del;
-    del.triangulate(mPoints);
-    mEdges.insert(mEdges.end(), del.getEdges().begin(), del.getEdges().end());
+    // find airwires between the subsets, sorted for the incremental mode
+    mMst.clear();
+    boruvkaMst(mParents);
+    std::sort(mMst.begin(), mMst.end(), &AirWiresBuilder::isShorter);
+    mIsBuilt = true;
   }
 
-  // determine weights of these new edges
-  for (uint i = connectedEdges; i < mEdges.size(); ++i) {
-    mEdges[i].weight = mEdges[i].p1.dist2(mEdges[i].p2);
+  AirWires airwires;
+  airwires.reserve(mMst.size());
+  for (const MstEdge& edge : mMst) {
+    const Node& p1 = mPoints[edge.p1];
+    const Node& p2 = mPoints[edge.p2];
+    airwires.append(qMakePair(Point(p1.x, p1.y), Point(p2.x, p2.y)));
   }
-
-  // find airwires in list of edges
-  return AirWiresBuilder::kruskalMst();
+  return airwires;
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-// adapted from horizon/kicad
-AirWiresBuilder::AirWires AirWiresBuilder::kruskalMst() noexcept {
-  unsigned int nodeNumber = mPoints.size();
-  unsigned int mstExpectedSize = nodeNumber - 1;
-  unsigned int mstSize = 0;
-  bool ratsnestLines = false;
-
-  // printf("mst nodes : %d edges : %d\n", mPoints.size(), mEdges.size () );
-  // The output
-  AirWires mst;
-
-  // Set tags for marking cycles
-  std::unordered_map<int, int> tags;
-  unsigned int tag = 0;
-
-  for (auto& node : mPoints) {
-    node.tag = tag;
-    tags[node.id] = tag++;
-  }
-
-  // Lists of nodes connected together (subtrees) to detect cycles in the
-  // graph
-  std::vector<std::list<int>> cycles(nodeNumber);
-
-  for (unsigned int i = 0; i < nodeNumber; ++i) cycles[i].push_back(i);
-
-  // Kruskal algorithm requires edges to be sorted by their weight
-  std::sort(mEdges.begin(), mEdges.end(),
-            [](const delaunay::Edge<qreal>& a, const delaunay::Edge<qreal>& b) {
-              return a.weight > b.weight;
-            });
-
-  while (mstSize < mstExpectedSize && !mEdges.empty()) {
-    auto& dt = mEdges.back();
-
-    int srcTag = tags[dt.p1.id];
-    int trgTag = tags[dt.p2.id];
-    // printf("mstSize %d %d %f %d<>%d\n", mstSize, mstExpectedSize,
-    // dt.weight, srcTag, trgTag);
-
-    // Check if by adding this edge we are going to join two different
-    // forests
-    if (srcTag != trgTag) {
-      // Because edges are sorted by their weight, first we always process
-      // connected
-      // items (weight == 0). Once we stumble upon an edge with non-zero
-      // weight,
-      // it means that the rest of the lines are ratsnest.
-      if (!ratsnestLines && dt.weight >= 0) ratsnestLines = true;
-
-      // Update tags
-      if (ratsnestLines) {
-        for (auto it = cycles[trgTag].begin(); it != cycles[trgTag].end();
-             ++it) {
-          tags[mPoints[*it].id] = srcTag;
-        }
+void AirWiresBuilder::applyRemovals() noexcept {
+  if (mRemovedIds.empty()) {
+    return;
+  }
+
+  // remove all edges of the removed points
+  for (auto it = mEdges.begin(); it != mEdges.end();) {
+    if (mRemoved[it->first] || mRemoved[it->second]) {
+      it = mEdges.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  if (mIsBuilt) {
+    // Removing points might split subsets, so determine them from scratch.
+    std::iota(mParents.begin(), mParents.end(), 0);
+    for (const auto& edge : mEdges) {
+      int root1 = findRoot(mParents, edge.first);
+      int root2 = findRoot(mParents, edge.second);
+      if (root1 != root2) {
+        mParents[root2] = root1;
+      }
+    }
+
+    // All remaining airwires are still part of the minimum spanning tree,
+    // since every cycle without the removed points existed before as well. So
+    // only the groups of subsets which are not connected by them anymore
+    // need to be connected again.
+    mMst.erase(std::remove_if(mMst.begin(), mMst.end(),
+                              [this](const MstEdge& edge) {
+                                return mRemoved[edge.p1] || mRemoved[edge.p2];
+                              }),
+               mMst.end());
+    std::vector<int> parents = mParents;
+    for (const MstEdge& edge : mMst) {
+      parents[findRoot(parents, edge.p2)] = findRoot(parents, edge.p1);
+    }
+    boruvkaMst(parents);
+    std::sort(mMst.begin(), mMst.end(), &AirWiresBuilder::isShorter);
+  }
+
+  mFreeIds.insert(mFreeIds.end(), mRemovedIds.begin(), mRemovedIds.end());
+  mRemovedIds.clear();
+}
 
-        // Do a copy of edge, but make it RN_EDGE_MST. In contrary to
-        // RN_EDGE,
-        // RN_EDGE_MST saves both source and target node and does not
-        // require any other
-        // edges to exist for getting source/target nodes
-        // CN_EDGE newEdge ( dt.GetSourceNode(), dt.GetTargetNode(),
-        // dt.GetWeight() );
-
-        // assert( newEdge.GetSourceNode()->GetTag() !=
-        // newEdge.GetTargetNode()->GetTag() );
-        // assert(dt.p1.tag != dt.p2.tag);
-        mst.append(qMakePair(Point(dt.p1.x, dt.p1.y), Point(dt.p2.x, dt.p2.y)));
-        ++mstSize;
+void AirWiresBuilder::boruvkaMst(std::vector<int> parents) noexcept {
+  // build the k-d tree of all points which are not removed
+  mOrder.clear();
+  for (std::size_t i = 0; i < mPoints.size(); ++i) {
+    if (!mRemoved[i]) {
+      mOrder.push_back(i);
+    }
+  }
+  if (mOrder.size() < 2) {
+    return;
+  }
+  mKdNodes.clear();
+  buildKdTree(0, mOrder.size());
+
+  // In each round, add the shortest edge leaving each subset. Since there is
+  // a strict order of all edges (ties are broken by the point IDs), this
+  // never creates cycles, and the number of subsets is at least halved.
+  mSubsets.resize(mPoints.size());
+  while (true) {
+    // determine the subset of each point and of each k-d tree node
+    for (int id : mOrder) {
+      mSubsets[id] = findRoot(parents, id);
+    }
+    for (int i = mKdNodes.size() - 1; i >= 0; --i) {
+      KdNode& node = mKdNodes[i];
+      if (node.left < 0) {
+        node.subset = mSubsets[mOrder[node.begin]];
+        for (int k = node.begin + 1; (k < node.end) && (node.subset >= 0);
+             ++k) {
+          if (mSubsets[mOrder[k]] != node.subset) {
+            node.subset = -1;
+          }
+        }
       } else {
-        // for( it = cycles[trgTag].begin(), itEnd =
-        // cycles[trgTag].end(); it != itEnd; ++it )
-        // for( auto it : cycles[trgTag] )
-        for (auto it = cycles[trgTag].begin(); it != cycles[trgTag].end();
-             ++it) {
-          tags[mPoints[*it].id] = srcTag;
-          mPoints[*it].tag = srcTag;
+        int left = mKdNodes[node.left].subset;
+        node.subset = (left == mKdNodes[node.right].subset) ? left : -1;
+      }
+    }
+    if (mKdNodes.front().subset >= 0) {
+      break;  // all points are connected now
+    }
+
+    // find the shortest edge leaving each subset
+    mShortestEdges.assign(
+        mPoints.size(), MstEdge{-1, -1, std::numeric_limits<qint64>::max()});
+    for (int id : mOrder) {
+      findShortestEdge(id, mShortestEdges[mSubsets[id]]);
+    }
+
+    // add these edges to the airwires
+    for (const MstEdge& edge : mShortestEdges) {
+      if (edge.p1 >= 0) {
+        int root1 = findRoot(parents, edge.p1);
+        int root2 = findRoot(parents, edge.p2);
+        if (root1 != root2) {  // the same edge may be found by both subsets
+          parents[root2] = root1;
+          mMst.push_back(edge);
         }
+      }
+    }
+  }
+}
 
-        // Processing a connection, decrease the expected size of the
-        // ratsnest MST
-        --mstExpectedSize;
+int AirWiresBuilder::buildKdTree(int begin, int end) noexcept {
+  KdNode node{std::numeric_limits<qint64>::max(),
+              std::numeric_limits<qint64>::max(),
+              std::numeric_limits<qint64>::min(),
+              std::numeric_limits<qint64>::min(),
+              begin,
+              end,
+              -1,
+              -1,
+              -1};
+  for (int i = begin; i < end; ++i) {
+    const Node& p = mPoints[mOrder[i]];
+    node.minX = qMin(node.minX, p.x);
+    node.minY = qMin(node.minY, p.y);
+    node.maxX = qMax(node.maxX, p.x);
+    node.maxY = qMax(node.maxY, p.y);
+  }
+  int index = mKdNodes.size();
+  mKdNodes.push_back(node);
+
+  if (end - begin > sMaxLeafSize) {
+    // split at the median of the wider dimension
+    bool splitX = (node.maxX - node.minX) >= (node.maxY - node.minY);
+    int middle = (begin + end) / 2;
+    std::nth_element(mOrder.begin() + begin, mOrder.begin() + middle,
+                     mOrder.begin() + end, [this, splitX](int a, int b) {
+                       return splitX ? (mPoints[a].x < mPoints[b].x)
+                                     : (mPoints[a].y < mPoints[b].y);
+                     });
+    int left = buildKdTree(begin, middle);
+    int right = buildKdTree(middle, end);
+    mKdNodes[index].left = left;  // note: node reference may be invalid now
+    mKdNodes[index].right = right;
+  }
+  return index;
+}
+
+void AirWiresBuilder::findShortestEdge(int p, MstEdge& shortest) noexcept {
+  const Node& point = mPoints[p];
+  int subset = mSubsets[p];
+  mStack.clear();
+  mStack.push_back(0);
+  while (!mStack.empty()) {
+    const KdNode& node = mKdNodes[mStack.back()];
+    mStack.pop_back();
+    if ((node.subset == subset) ||
+        (distance2(node, point) > shortest.weight)) {
+      continue;  // no (shorter) edge leaving the subset in this node
+    }
+    if (node.left < 0) {
+      for (int i = node.begin; i < node.end; ++i) {
+        int q = mOrder[i];
+        if (mSubsets[q] != subset) {
+          MstEdge edge{qMin(p, q), qMax(p, q), distance2(p, q)};
+          if (isShorter(edge, shortest)) {
+            shortest = edge;
+          }
+        }
+      }
+    } else {
+      // visit the nearer child first, i.e. push it last
+      int nearChild = node.left;
+      int farChild = node.right;
+      if (distance2(mKdNodes[farChild], point) <
+          distance2(mKdNodes[nearChild], point)) {
+        std::swap(nearChild, farChild);
       }
+      mStack.push_back(farChild);
+      mStack.push_back(nearChild);
+    }
+  }
+}
 
-      // Move nodes that were marked with old tag to the list marked with
-      // the new tag
-      cycles[srcTag].splice(cycles[srcTag].end(), cycles[trgTag]);
+void AirWiresBuilder::insertPointIntoMst(int id) noexcept {
+  // The new minimum spanning tree is the minimum spanning tree of the old
+  // airwires plus the shortest edge from the new point to each subset. The
+  // old airwires are kept sorted, so only the new edges need to be sorted.
+  std::unordered_map<int, MstEdge> nearest;  // root -> shortest edge
+  for (int i = 0; i < static_cast<int>(mPoints.size()); ++i) {
+    if ((i == id) || mRemoved[i]) continue;
+    MstEdge edge{qMin(i, id), qMax(i, id), distance2(i, id)};
+    auto result = nearest.insert(std::make_pair(findRoot(mParents, i), edge));
+    if ((!result.second) && isShorter(edge, result.first->second)) {
+      result.first->second = edge;
     }
+  }
+  std::vector<MstEdge> newEdges;
+  newEdges.reserve(nearest.size());
+  for (const auto& pair : nearest) {
+    newEdges.push_back(pair.second);
+  }
+  std::sort(newEdges.begin(), newEdges.end(), &AirWiresBuilder::isShorter);
+  std::vector<MstEdge> edges;
+  edges.reserve(mMst.size() + newEdges.size());
+  std::merge(mMst.begin(), mMst.end(), newEdges.begin(), newEdges.end(),
+             std::back_inserter(edges), &AirWiresBuilder::isShorter);
+
+  mMst.clear();
+  std::vector<int> parents = mParents;
+  for (const MstEdge& edge : edges) {
+    int root1 = findRoot(parents, edge.p1);
+    int root2 = findRoot(parents, edge.p2);
+    if (root1 != root2) {
+      parents[root2] = root1;
+      mMst.push_back(edge);
+    }
+  }
+}
 
-    // Remove the edge that was just processed
-    mEdges.pop_back();
+void AirWiresBuilder::insertEdgeIntoMst(int p1, int p2) noexcept {
+  int root1 = findRoot(mParents, p1);
+  int root2 = findRoot(mParents, p2);
+  if (root1 == root2) {
+    return;  // already connected, nothing changes
   }
 
-  return mst;
+  // The airwires form a tree between the connected subsets. Connecting two
+  // subsets closes a cycle in this tree, and removing the longest airwire of
+  // that cycle results in the new minimum spanning tree. So search the path
+  // between both subsets (breadth-first search).
+  std::unordered_map<int, std::vector<int>> adjacency;  // root -> edge indices
+  for (std::size_t i = 0; i < mMst.size(); ++i) {
+    adjacency[findRoot(mParents, mMst[i].p1)].push_back(i);
+    adjacency[findRoot(mParents, mMst[i].p2)].push_back(i);
+  }
+  std::unordered_map<int, int> reachedVia;  // root -> edge index
+  std::vector<int> queue = {root1};
+  reachedVia[root1] = -1;
+  for (std::size_t i = 0; (i < queue.size()) && (!reachedVia.count(root2));
+       ++i) {
+    for (int index : adjacency[queue[i]]) {
+      int other = findRoot(mParents, mMst[index].p1);
+      if (other == queue[i]) {
+        other = findRoot(mParents, mMst[index].p2);
+      }
+      if (!reachedVia.count(other)) {
+        reachedVia[other] = index;
+        queue.push_back(other);
+      }
+    }
+  }
+
+  // remove the longest airwire on the path
+  if (reachedVia.count(root2)) {
+    int longest = -1;
+    for (int node = root2; node != root1;) {
+      int index = reachedVia[node];
+      if ((longest < 0) || isShorter(mMst[longest], mMst[index])) {
+        longest = index;
+      }
+      int other = findRoot(mParents, mMst[index].p1);
+      node = (other != node) ? other : findRoot(mParents, mMst[index].p2);
+    }
+    mMst.erase(mMst.begin() + longest);
+  }
+
+  mParents[root2] = root1;
+}
+
+qint64 AirWiresBuilder::distance2(int p1, int p2) const noexcept {
+  qint64 dx = mPoints[p1].x - mPoints[p2].x;
+  qint64 dy = mPoints[p1].y - mPoints[p2].y;
+  return dx * dx + dy * dy;
+}
+
+qint64 AirWiresBuilder::distance2(const KdNode& node,
+                                  const Node& point) noexcept {
+  qint64 dx = qMax(qMax(node.minX - point.x, point.x - node.maxX), qint64(0));
+  qint64 dy = qMax(qMax(node.minY - point.y, point.y - node.maxY), qint64(0));
+  return dx * dx + dy * dy;
+}
+
+bool AirWiresBuilder::isShorter(const MstEdge& a, const MstEdge& b) noexcept {
+  if (a.weight != b.weight) return a.weight < b.weight;
+  if (a.p1 != b.p1) return a.p1 < b.p1;
+  return a.p2 < b.p2;
+}
+
+int AirWiresBuilder::findRoot(std::vector<int>& parents, int id) noexcept {
+  while (parents[id] != id) {
+    parents[id] = parents[parents[id]];  // path halving
+    id = parents[id];
+  }
+  return id;
 }
 
 /*******************************************************************************
@@ -25,10 +25,11 @@
  ******************************************************************************/
 #include "../units/point.h"
 
-#include <delaunay-triangulation/delaunay.h>
-
 #include <QtCore>
 
+#include <set>
+#include <vector>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -40,6 +41,24 @@ namespace librepcb {
 
 /**
  * @brief The AirWiresBuilder class
+ *
+ * Determines the airwires (a minimum spanning tree between the subsets of
+ * already connected points) of a set of points.
+ *
+ * The minimum spanning tree is calculated with Boruvka's algorithm: In each
+ * round, the shortest edge leaving each subset is determined with a nearest
+ * neighbor search in a k-d tree, and all these edges are added to the tree.
+ * All calculations are done with the integer nanometer coordinates, i.e.
+ * without rounding issues, and ties are broken by the point IDs, so the
+ * result is exact and deterministic. Coordinates must be within +/-1m to
+ * avoid integer overflows.
+ *
+ * After #buildAirWires() was called once, the builder switches to the
+ * incremental mode: the result is kept and further calls to #addPoint(),
+ * #removePoint() and #addEdge() update it directly, without running the whole
+ * algorithm again. Subsequent calls to #buildAirWires() then just return the
+ * updated result. This is much faster when adding traces to a net with many
+ * points. Moving a point is done by removing it and adding it again.
  */
 class AirWiresBuilder final {
   Q_DECLARE_TR_FUNCTIONS(AirWiresBuilder)
@@ -71,15 +90,36 @@ public:
   /**
    * @brief Add a new point
    *
+   * In incremental mode, the airwires are updated in O(n + k log k) time,
+   * with n points and k subsets of connected points.
+   *
+   * @note The coordinates must be within +/-1m.
+   *
    * @param p   The point to add
    *
    * @return The ID of the added point
    */
   int addPoint(const Point& p) noexcept;
 
+  /**
+   * @brief Remove a point and all its edges
+   *
+   * The ID of the removed point may be reused by the next call to
+   * #addPoint(). In incremental mode, the airwires are updated as soon as
+   * the next method is called. All removals up to then are handled at once
+   * in O(m + n log n) time with m edges, since removing points may split
+   * subsets and the airwires of the removed points need to be replaced.
+   *
+   * @param id  ID of the point to remove
+   */
+  void removePoint(int id) noexcept;
+
   /**
    * @brief Add an edge between two points
    *
+   * In incremental mode, the airwires are updated in O(n) time (nothing to do
+   * at all if the points were already connected).
+   *
    * @param p1  ID of first point
    * @param p2  ID of second point
    */
@@ -95,12 +135,59 @@ public:
   // Operator overloadings
   AirWiresBuilder& operator=(const AirWiresBuilder& rhs) = delete;
 
+private:  // Types
+  struct Node {
+    qint64 x;
+    qint64 y;
+  };
+  struct MstEdge {
+    int p1;
+    int p2;
+    qint64 weight;  ///< squared length
+  };
+  struct KdNode {
+    qint64 minX;
+    qint64 minY;
+    qint64 maxX;
+    qint64 maxY;
+    int begin;  ///< first index in #mOrder
+    int end;  ///< last index in #mOrder + 1
+    int left;  ///< index of child node, -1 for leafs
+    int right;  ///< index of child node, -1 for leafs
+    int subset;  ///< subset of all contained points, or -1 if different
+  };
+
 private:  // Methods
-  AirWires kruskalMst() noexcept;
+  void applyRemovals() noexcept;
+  void boruvkaMst(std::vector<int> parents) noexcept;
+  int buildKdTree(int begin, int end) noexcept;
+  void findShortestEdge(int p, MstEdge& shortest) noexcept;
+  void insertPointIntoMst(int id) noexcept;
+  void insertEdgeIntoMst(int p1, int p2) noexcept;
+  qint64 distance2(int p1, int p2) const noexcept;
+  static qint64 distance2(const KdNode& node, const Node& point) noexcept;
+  static bool isShorter(const MstEdge& a, const MstEdge& b) noexcept;
+  static int findRoot(std::vector<int>& parents, int id) noexcept;
 
 private:  // Data
-  std::vector<delaunay::Vector2<qreal>> mPoints;
-  std::vector<delaunay::Edge<qreal>> mEdges;
+  std::vector<Node> mPoints;
+  std::vector<bool> mRemoved;  ///< point ID -> whether it was removed
+  std::vector<int> mRemovedIds;  ///< Removed, but not handled yet
+  std::vector<int> mFreeIds;  ///< Removed and handled, i.e. reusable
+  std::set<std::pair<int, int>> mEdges;  ///< Normalized (first < second)
+  std::vector<int> mParents;  ///< Union-find of connected points (by edges)
+  std::vector<MstEdge> mMst;  ///< The airwires, sorted (valid after building)
+  bool mIsBuilt;  ///< Whether in incremental mode or not
+
+  // Scratch buffers, reused by all rounds of the algorithm
+  std::vector<int> mOrder;  ///< point IDs, ordered by the k-d tree
+  std::vector<KdNode> mKdNodes;  ///< k-d tree, children after parents
+  std::vector<int> mSubsets;  ///< point ID -> subset
+  std::vector<MstEdge> mShortestEdges;  ///< subset -> shortest edge
+  std::vector<int> mStack;  ///< k-d tree nodes to visit
+
+  // Constants
+  static const int sMaxLeafSize = 8;
 };
 
 /*******************************************************************************
@@ -0,0 +1,119 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "polygonindex.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+PolygonIndex::PolygonIndex() noexcept : mPolygons() {
+}
+
+PolygonIndex::PolygonIndex(const PolygonIndex& other) noexcept
+  : mPolygons(other.mPolygons) {
+}
+
+PolygonIndex::PolygonIndex(const QVector<Path>& polygons) noexcept
+  : mPolygons() {
+  mPolygons.reserve(polygons.count());
+  foreach (const Path& polygon, polygons) {
+    Entry entry{std::numeric_limits<qint64>::max(),
+                std::numeric_limits<qint64>::max(),
+                std::numeric_limits<qint64>::min(),
+                std::numeric_limits<qint64>::min(), polygon};
+    foreach (const Vertex& vertex, polygon.getVertices()) {
+      entry.minX = qMin(entry.minX, vertex.getPos().getX().toNm());
+      entry.minY = qMin(entry.minY, vertex.getPos().getY().toNm());
+      entry.maxX = qMax(entry.maxX, vertex.getPos().getX().toNm());
+      entry.maxY = qMax(entry.maxY, vertex.getPos().getY().toNm());
+    }
+    mPolygons.append(entry);
+  }
+}
+
+PolygonIndex::~PolygonIndex() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+int PolygonIndex::indexOf(const Point& point) const noexcept {
+  qint64 x = point.getX().toNm();
+  qint64 y = point.getY().toNm();
+  for (int i = 0; i < mPolygons.count(); ++i) {
+    const Entry& entry = mPolygons.at(i);
+    if ((x < entry.minX) || (x > entry.maxX) || (y < entry.minY) ||
+        (y > entry.maxY)) {
+      continue;  // fast path: outside of the bounding box
+    }
+    if (contains(entry.polygon, point)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool PolygonIndex::contains(const Path& polygon, const Point& point) noexcept {
+  const QVector<Vertex>& vertices = polygon.getVertices();
+  qint64 px = point.getX().toNm();
+  qint64 py = point.getY().toNm();
+  bool inside = false;
+  for (int i = 0, j = vertices.count() - 1; i < vertices.count(); j = i++) {
+    qint64 ax = vertices.at(j).getPos().getX().toNm();
+    qint64 ay = vertices.at(j).getPos().getY().toNm();
+    qint64 bx = vertices.at(i).getPos().getX().toNm();
+    qint64 by = vertices.at(i).getPos().getY().toNm();
+    if ((ay > py) != (by > py)) {
+      // Check if the edge crosses the horizontal ray starting at the point to
+      // the right, without dividing (exact integer arithmetic).
+      qint64 cross = (bx - ax) * (py - ay) - (px - ax) * (by - ay);
+      if ((by > ay) ? (cross > 0) : (cross < 0)) {
+        inside = !inside;
+      }
+    }
+  }
+  return inside;
+}
+
+/*******************************************************************************
+ *  Operator Overloadings
+ ******************************************************************************/
+
+PolygonIndex& PolygonIndex::operator=(const PolygonIndex& rhs) noexcept {
+  mPolygons = rhs.mPolygons;
+  return *this;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,112 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_POLYGONINDEX_H
+#define LIBREPCB_POLYGONINDEX_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../geometry/path.h"
+#include "../units/point.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class PolygonIndex
+ ******************************************************************************/
+
+/**
+ * @brief Fast lookup of the polygon containing a given point
+ *
+ * The bounding boxes of all polygons are determined once on construction, so
+ * a lookup only needs to run the point-in-polygon test for polygons whose
+ * bounding box contains the point. The test works on the integer coordinates
+ * (nanometers) of the vertices, i.e. without any floating point rounding.
+ *
+ * @note Arc segments are treated as straight lines, so this is intended for
+ *       flattened polygons like the fragments of a plane. Coordinates must be
+ *       within +/-1m to avoid integer overflows.
+ */
+class PolygonIndex final {
+public:
+  // Constructors / Destructor
+  PolygonIndex() noexcept;
+  PolygonIndex(const PolygonIndex& other) noexcept;
+  explicit PolygonIndex(const QVector<Path>& polygons) noexcept;
+  ~PolygonIndex() noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Get the number of indexed polygons
+   */
+  int count() const noexcept { return mPolygons.count(); }
+
+  /**
+   * @brief Find the polygon containing a point
+   *
+   * @param point   The point to look for
+   *
+   * @return The index of the first polygon containing the point, or -1 if
+   *         no polygon contains it
+   */
+  int indexOf(const Point& point) const noexcept;
+
+  /**
+   * @brief Check if a point is inside a (closed) polygon
+   *
+   * Uses the even-odd rule, like QPainterPath::contains() for paths created
+   * by Path::toQPainterPathPx().
+   *
+   * @param polygon   The polygon (closing segment is added implicitly)
+   * @param point     The point to check
+   *
+   * @return Whether the point is inside the polygon
+   */
+  static bool contains(const Path& polygon, const Point& point) noexcept;
+
+  // Operator Overloadings
+  PolygonIndex& operator=(const PolygonIndex& rhs) noexcept;
+
+private:  // Types
+  struct Entry {
+    qint64 minX;
+    qint64 minY;
+    qint64 maxX;
+    qint64 maxY;
+    Path polygon;
+  };
+
+private:  // Data
+  QVector<Entry> mPolygons;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_POLYGONINDEX_H
@@ -24,6 +24,9 @@
 
 #include <QtCore>
 
+#include <algorithm>
+#include <iterator>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -63,76 +66,96 @@ QString GerberApertureList::generateString() const noexcept {
 
 int GerberApertureList::setCircle(const UnsignedLength& dia,
                                   const UnsignedLength& hole) {
-  return setCurrentAperture(generateCircle(dia, hole));
+  Key key{Type::Circle, {dia->toNm(), hole->toNm(), 0, 0, 0}};
+  return getCachedAperture(
+      key, [&]() { return setCurrentAperture(generateCircle(dia, hole)); });
 }
 
 int GerberApertureList::setRect(const UnsignedLength& w,
                                 const UnsignedLength& h, const Angle& rot,
                                 const UnsignedLength& hole) noexcept {
-  if (rot % Angle::deg180() == 0) {
-    return setCurrentAperture(generateRect(w, h, hole));
-  } else if (rot % Angle::deg90() == 0) {
-    return setCurrentAperture(generateRect(h, w, hole));
-  } else {
-    // Rotation is not a multiple of 90 degrees --> we need to use an aperture
-    // macro
-    if (hole > 0) {
-      addMacro(generateRotatedRectMacroWithHole());
+  Key key{Type::Rect,
+          {w->toNm(), h->toNm(), rot.toMicroDeg(), hole->toNm(), 0}};
+  return getCachedAperture(key, [&]() -> int {
+    if (rot % Angle::deg180() == 0) {
+      return setCurrentAperture(generateRect(w, h, hole));
+    } else if (rot % Angle::deg90() == 0) {
+      return setCurrentAperture(generateRect(h, w, hole));
     } else {
-      addMacro(generateRotatedRectMacro());
+      // Rotation is not a multiple of 90 degrees --> we need to use an
+      // aperture macro
+      if (hole > 0) {
+        addMacro(generateRotatedRectMacroWithHole());
+      } else {
+        addMacro(generateRotatedRectMacro());
+      }
+      return setCurrentAperture(generateRotatedRect(w, h, rot, hole));
     }
-    return setCurrentAperture(generateRotatedRect(w, h, rot, hole));
-  }
+  });
 }
 
 int GerberApertureList::setObround(const UnsignedLength& w,
                                    const UnsignedLength& h, const Angle& rot,
                                    const UnsignedLength& hole) noexcept {
-  if (rot % Angle::deg180() == 0) {
-    return setCurrentAperture(generateObround(w, h, hole));
-  } else if (rot % Angle::deg90() == 0) {
-    return setCurrentAperture(generateObround(h, w, hole));
-  } else {
-    // Rotation is not a multiple of 90 degrees --> we need to use an aperture
-    // macro
-    if (hole > 0) {
-      addMacro(generateRotatedObroundMacroWithHole());
+  Key key{Type::Obround,
+          {w->toNm(), h->toNm(), rot.toMicroDeg(), hole->toNm(), 0}};
+  return getCachedAperture(key, [&]() -> int {
+    if (rot % Angle::deg180() == 0) {
+      return setCurrentAperture(generateObround(w, h, hole));
+    } else if (rot % Angle::deg90() == 0) {
+      return setCurrentAperture(generateObround(h, w, hole));
     } else {
-      addMacro(generateRotatedObroundMacro());
+      // Rotation is not a multiple of 90 degrees --> we need to use an
+      // aperture macro
+      if (hole > 0) {
+        addMacro(generateRotatedObroundMacroWithHole());
+      } else {
+        addMacro(generateRotatedObroundMacro());
+      }
+      return setCurrentAperture(generateRotatedObround(w, h, rot, hole));
     }
-    return setCurrentAperture(generateRotatedObround(w, h, rot, hole));
-  }
+  });
 }
 
 int GerberApertureList::setRegularPolygon(const UnsignedLength& dia, int n,
                                           const Angle& rot,
                                           const UnsignedLength& hole) noexcept {
-  if (n < 3 || n > 12) {
-    qWarning() << "Gerber Export: Specified number of vertices not supported "
-                  "by gerber specs:"
-               << n;
-  }
-  // Adjust rotation as its interpretation differs between LibrePCB and Gerber
-  // specs
-  Angle grbRot = rot + (Angle::deg180() / (n > 0 ? n : 1));
-  return setCurrentAperture(generateRegularPolygon(dia, n, grbRot, hole));
+  Key key{Type::RegularPolygon,
+          {dia->toNm(), n, rot.toMicroDeg(), hole->toNm(), 0}};
+  return getCachedAperture(key, [&]() -> int {
+    if (n < 3 || n > 12) {
+      qWarning() << "Gerber Export: Specified number of vertices not supported "
+                    "by gerber specs:"
+                 << n;
+    }
+    // Adjust rotation as its interpretation differs between LibrePCB and
+    // Gerber specs
+    Angle grbRot = rot + (Angle::deg180() / (n > 0 ? n : 1));
+    return setCurrentAperture(generateRegularPolygon(dia, n, grbRot, hole));
+  });
 }
 
 int GerberApertureList::setOctagon(const UnsignedLength& w,
                                    const UnsignedLength& h,
                                    const UnsignedLength& edge, const Angle& rot,
                                    const UnsignedLength& hole) noexcept {
-  if (hole > 0) {
-    addMacro(generateRotatedOctagonMacroWithHole());
-  } else {
-    addMacro(generateRotatedOctagonMacro());
-  }
-  return setCurrentAperture(generateRotatedOctagon(w, h, edge, rot, hole));
+  Key key{Type::Octagon, {w->toNm(), h->toNm(), edge->toNm(),
+                          rot.toMicroDeg(), hole->toNm()}};
+  return getCachedAperture(key, [&]() -> int {
+    if (hole > 0) {
+      addMacro(generateRotatedOctagonMacroWithHole());
+    } else {
+      addMacro(generateRotatedOctagonMacro());
+    }
+    return setCurrentAperture(generateRotatedOctagon(w, h, edge, rot, hole));
+  });
 }
 
 void GerberApertureList::reset() noexcept {
   // mApertureMacros.clear();
   mApertures.clear();
+  mApertureNumbers.clear();
+  mApertureCache.clear();
 }
 
 /*******************************************************************************
@@ -140,11 +163,12 @@ void GerberApertureList::reset() noexcept {
  ******************************************************************************/
 
 int GerberApertureList::setCurrentAperture(const QString& aperture) noexcept {
-  int number = mApertures.key(aperture, -1);
+  int number = mApertureNumbers.value(aperture, -1);
   if (number < 0) {
     number = mApertures.count() + 10;  // 10 is the number of the first aperture
     Q_ASSERT(!mApertures.contains(number));
     mApertures.insert(number, aperture);
+    mApertureNumbers.insert(aperture, number);
   }
   return number;
 }
@@ -155,6 +179,20 @@ void GerberApertureList::addMacro(const QString& macro) noexcept {
   }
 }
 
+bool GerberApertureList::Key::operator==(const Key& rhs) const noexcept {
+  return (type == rhs.type) &&
+      std::equal(std::begin(values), std::end(values), std::begin(rhs.values));
+}
+
+uint qHash(const GerberApertureList::Key& key, uint seed) noexcept {
+  seed ^= ::qHash(static_cast<int>(key.type));
+  for (LengthBase_t value : key.values) {
+    // same combination as boost::hash_combine()
+    seed ^= ::qHash(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+  return seed;
+}
+
 /*******************************************************************************
  *  Aperture Generator Methods
  ******************************************************************************/
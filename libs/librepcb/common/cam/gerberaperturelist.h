@@ -41,6 +41,11 @@ namespace librepcb {
 
 /**
  * @brief The GerberApertureList class
+ *
+ * Apertures are looked up by their parameters in a hash table, so requesting
+ * the same aperture many times (e.g. for thousands of identical pads) costs
+ * neither the generation of the aperture definition string nor a linear
+ * search over all existing apertures.
  */
 class GerberApertureList final {
   Q_DECLARE_TR_FUNCTIONS(GerberApertureList)
@@ -72,7 +77,26 @@ public:
   GerberApertureList& operator=(const GerberApertureList& rhs) = delete;
 
 private:
+  // Types
+  enum class Type { Circle, Rect, Obround, RegularPolygon, Octagon };
+  struct Key {
+    Type type;
+    LengthBase_t values[5];
+    bool operator==(const Key& rhs) const noexcept;
+  };
+  friend uint qHash(const Key& key, uint seed) noexcept;
+
   // Private Methods
+  template <typename Generator>
+  int getCachedAperture(const Key& key, Generator generator) noexcept {
+    auto it = mApertureCache.constFind(key);
+    if (it != mApertureCache.constEnd()) {
+      return *it;
+    }
+    int number = generator();
+    mApertureCache.insert(key, number);
+    return number;
+  }
   int setCurrentAperture(const QString& aperture) noexcept;
   void addMacro(const QString& macro) noexcept;
 
@@ -109,6 +133,8 @@ private:
   QList<QString> mApertureMacros;
   QMap<int, QString>
       mApertures;  ///< key: aperture number (>= 10); value: aperture definition
+  QHash<QString, int> mApertureNumbers;  ///< Reverse lookup of #mApertures
+  QHash<Key, int> mApertureCache;  ///< key: parameters; value: aperture number
 };
 
 /*******************************************************************************
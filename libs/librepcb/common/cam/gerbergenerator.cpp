@@ -30,6 +30,8 @@
 
 #include <QtCore>
 
+#include <cstring>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -46,6 +48,8 @@ GerberGenerator::GerberGenerator(const QString& projName, const Uuid& projUuid,
     mProjectRevision(escapeString(projRevision)),
     mOutput(),
     mContent(),
+    mOutputDevice(nullptr),
+    mOutputChecksum(QCryptographicHash::Md5),
     mApertureList(new GerberApertureList()),
     mCurrentApertureNumber(-1),
     mMultiQuadrantArcModeOn(false) {
@@ -172,15 +176,28 @@ void GerberGenerator::reset() noexcept {
 }
 
 void GerberGenerator::generate() {
-  mOutput.clear();
-  printHeader();
-  printApertureList();
-  printContent();
-  printFooter();
+  print(nullptr);
 }
 
 void GerberGenerator::saveToFile(const FilePath& filepath) const {
-  FileUtils::writeFile(filepath, mOutput.toLatin1());  // can throw
+  FileUtils::writeFile(filepath, mOutput);  // can throw
+}
+
+void GerberGenerator::generateToFile(const FilePath& filepath) {
+  FileUtils::makePath(filepath.getParentDir());  // can throw
+  QSaveFile file(filepath.toStr());
+  if (!file.open(QIODevice::WriteOnly)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not open or create file \"%1\": %2")
+                           .arg(filepath.toNative(), file.errorString()));
+  }
+  print(&file);
+  // note: commit() also fails if any write operation has failed
+  if (!file.commit()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not write to file \"%1\": %2")
+                           .arg(filepath.toNative(), file.errorString()));
+  }
 }
 
 /*******************************************************************************
@@ -189,7 +206,9 @@ void GerberGenerator::saveToFile(const FilePath& filepath) const {
 
 void GerberGenerator::setCurrentAperture(int number) noexcept {
   if (number != mCurrentApertureNumber) {
-    mContent.append(QString("D%1*\n").arg(number));
+    mContent.append('D');
+    appendInteger(mContent, number);
+    mContent.append("*\n");
     mCurrentApertureNumber = number;
   }
 }
@@ -229,13 +248,13 @@ void GerberGenerator::switchToCircularCcwInterpolationModeG03() noexcept {
 }
 
 void GerberGenerator::moveToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D02*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendPosition(pos);
+  mContent.append("D02*\n");
 }
 
 void GerberGenerator::linearInterpolateToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D01*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendPosition(pos);
+  mContent.append("D01*\n");
 }
 
 void GerberGenerator::circularInterpolateToPosition(const Point& start,
@@ -245,9 +264,12 @@ void GerberGenerator::circularInterpolateToPosition(const Point& start,
   if (!mMultiQuadrantArcModeOn) {
     diff.makeAbs();  // no sign allowed in single quadrant mode!
   }
-  mContent.append(QString("X%1Y%2I%3J%4D01*\n")
-                      .arg(end.getX().toNmString(), end.getY().toNmString(),
-                           diff.getX().toNmString(), diff.getY().toNmString()));
+  appendPosition(end);
+  mContent.append('I');
+  appendInteger(mContent, diff.getX().toNm());
+  mContent.append('J');
+  appendInteger(mContent, diff.getY().toNm());
+  mContent.append("D01*\n");
 }
 
 void GerberGenerator::interpolateBetween(const Vertex& from,
@@ -274,12 +296,30 @@ void GerberGenerator::interpolateBetween(const Vertex& from,
 }
 
 void GerberGenerator::flashAtPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D03*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendPosition(pos);
+  mContent.append("D03*\n");
+}
+
+void GerberGenerator::appendPosition(const Point& pos) noexcept {
+  mContent.append('X');
+  appendInteger(mContent, pos.getX().toNm());
+  mContent.append('Y');
+  appendInteger(mContent, pos.getY().toNm());
+}
+
+void GerberGenerator::print(QIODevice* device) noexcept {
+  mOutput.clear();
+  mOutputDevice = device;
+  mOutputChecksum.reset();
+  printHeader();
+  printApertureList();
+  printContent();
+  printFooter();
+  mOutputDevice = nullptr;
 }
 
 void GerberGenerator::printHeader() noexcept {
-  mOutput.append("G04 --- HEADER BEGIN --- *\n");
+  writeOutput("G04 --- HEADER BEGIN --- *\n");
 
   // add some X2 attributes
   QString appVersion = qApp->applicationVersion();
@@ -287,57 +327,72 @@ void GerberGenerator::printHeader() noexcept {
   QString projId = mProjectId.remove(',');
   QString projUuid = mProjectUuid.toStr();
   QString projRevision = mProjectRevision.remove(',');
-  mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n")
-                     .arg(appVersion));
-  mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
-  mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n")
-                     .arg(projId, projUuid, projRevision));
-  mOutput.append("%TF.Part,Single*%\n");  // "Single" means "this is a PCB"
-  // mOutput.append("%TF.FilePolarity,Positive*%\n");
+  writeOutput(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n")
+                  .arg(appVersion)
+                  .toLatin1());
+  writeOutput(QString("%TF.CreationDate,%1*%\n").arg(creationDate).toLatin1());
+  writeOutput(QString("%TF.ProjectId,%1,%2,%3*%\n")
+                  .arg(projId, projUuid, projRevision)
+                  .toLatin1());
+  writeOutput("%TF.Part,Single*%\n");  // "Single" means "this is a PCB"
+  // writeOutput("%TF.FilePolarity,Positive*%\n");
 
   // coordinate format specification:
   //  - leading zeros omitted
   //  - absolute coordinates
   //  - coordiante format "6.6" --> allows us to directly use LengthBase_t
   //  (nanometers)!
-  mOutput.append("%FSLAX66Y66*%\n");
+  writeOutput("%FSLAX66Y66*%\n");
 
   // set unit to millimeters
-  mOutput.append("%MOMM*%\n");
+  writeOutput("%MOMM*%\n");
 
   // start linear interpolation mode
-  mOutput.append("G01*\n");
+  writeOutput("G01*\n");
 
   // use single quadrant arc mode
-  mOutput.append("G74*\n");
+  writeOutput("G74*\n");
 
-  mOutput.append("G04 --- HEADER END --- *\n");
+  writeOutput("G04 --- HEADER END --- *\n");
 }
 
 void GerberGenerator::printApertureList() noexcept {
-  mOutput.append(mApertureList->generateString());
+  writeOutput(mApertureList->generateString().toLatin1());
 }
 
 void GerberGenerator::printContent() noexcept {
-  mOutput.append("G04 --- BOARD BEGIN --- *\n");
-  mOutput.append(mContent);
-  mOutput.append("G04 --- BOARD END --- *\n");
+  writeOutput("G04 --- BOARD BEGIN --- *\n");
+  writeOutput(mContent);
+  writeOutput("G04 --- BOARD END --- *\n");
 }
 
 void GerberGenerator::printFooter() noexcept {
-  // MD5 checksum over content
-  mOutput.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()));
+  // MD5 checksum over content (updated by writeOutput() on the fly)
+  QByteArray checksum = mOutputChecksum.result().toHex();
+  writeOutput("%TF.MD5," + checksum + "*%\n");
 
   // end of file
-  mOutput.append("M02*\n");
+  writeOutput("M02*\n");
 }
 
-QString GerberGenerator::calcOutputMd5Checksum() const noexcept {
+void GerberGenerator::writeOutput(const QByteArray& data) noexcept {
   // according to the RS-274C standard, linebreaks are not included in the
   // checksum
-  QString data = QString(mOutput).remove(QChar('\n'));
-  return QString(
-      QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+  const char* begin = data.constData();
+  const char* end = begin + data.size();
+  while (begin < end) {
+    const char* lineEnd =
+        static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    if (!lineEnd) lineEnd = end;
+    mOutputChecksum.addData(begin, lineEnd - begin);
+    begin = lineEnd + 1;
+  }
+
+  if (mOutputDevice) {
+    mOutputDevice->write(data);  // errors are reported by QSaveFile::commit()
+  } else {
+    mOutput.append(data);
+  }
 }
 
 /*******************************************************************************
@@ -358,6 +413,21 @@ QString GerberGenerator::escapeString(const QString& str) noexcept {
   return ret;
 }
 
+void GerberGenerator::appendInteger(QByteArray& buffer, qint64 value) noexcept {
+  // much faster than QString::number(), but with the same result
+  char digits[24];
+  char* end = digits + sizeof(digits);
+  char* begin = end;
+  quint64 absValue = (value < 0) ? (0 - static_cast<quint64>(value))
+                                 : static_cast<quint64>(value);
+  do {
+    *(--begin) = static_cast<char>('0' + (absValue % 10));
+    absValue /= 10;
+  } while (absValue > 0);
+  if (value < 0) *(--begin) = '-';
+  buffer.append(begin, end - begin);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -69,7 +69,7 @@ public:
   ~GerberGenerator() noexcept;
 
   // Getters
-  const QString& toStr() const noexcept { return mOutput; }
+  const QByteArray& toByteArray() const noexcept { return mOutput; }
 
   // Plot Methods
   void setLayerPolarity(LayerPolarity p) noexcept;
@@ -100,6 +100,18 @@ public:
   void generate();
   void saveToFile(const FilePath& filepath) const;
 
+  /**
+   * @brief Generate the output and stream it directly into a file
+   *
+   * Same as #generate() followed by #saveToFile(), but without keeping the
+   * whole output in memory (#toByteArray() will be empty afterwards).
+   *
+   * @param filepath  The file to write (will be overwritten if existing)
+   *
+   * @throw Exception If the file could not be written.
+   */
+  void generateToFile(const FilePath& filepath);
+
   // Operator Overloadings
   GerberGenerator& operator=(const GerberGenerator& rhs) = delete;
 
@@ -119,14 +131,17 @@ private:
                                      const Point& end) noexcept;
   void interpolateBetween(const Vertex& from, const Vertex& to) noexcept;
   void flashAtPosition(const Point& pos) noexcept;
+  void appendPosition(const Point& pos) noexcept;
+  void print(QIODevice* device) noexcept;
   void printHeader() noexcept;
   void printApertureList() noexcept;
   void printContent() noexcept;
   void printFooter() noexcept;
-  QString calcOutputMd5Checksum() const noexcept;
+  void writeOutput(const QByteArray& data) noexcept;
 
   // Static Methods
   static QString escapeString(const QString& str) noexcept;
+  static void appendInteger(QByteArray& buffer, qint64 value) noexcept;
 
   // Metadata
   QString mProjectId;
@@ -134,8 +149,10 @@ private:
   QString mProjectRevision;
 
   // Gerber Data
-  QString mOutput;
-  QString mContent;
+  QByteArray mOutput;  ///< Empty if streamed into a file
+  QByteArray mContent;
+  QIODevice* mOutputDevice;  ///< Only set while streaming into a file
+  QCryptographicHash mOutputChecksum;  ///< Updated with every output line
   QScopedPointer<GerberApertureList> mApertureList;
   int mCurrentApertureNumber;
   bool mMultiQuadrantArcModeOn;
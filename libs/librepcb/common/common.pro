@@ -33,6 +33,7 @@ RESOURCES += \
 
 SOURCES += \
     algorithm/airwiresbuilder.cpp \
+    algorithm/polygonindex.cpp \
     alignment.cpp \
     application.cpp \
     attributes/attribute.cpp \
@@ -103,6 +104,7 @@ SOURCES += \
     graphics/graphicsscene.cpp \
     graphics/graphicsview.cpp \
     graphics/holegraphicsitem.cpp \
+    graphics/levelofdetailpath.cpp \
     graphics/linegraphicsitem.cpp \
     graphics/origincrossgraphicsitem.cpp \
     graphics/polygongraphicsitem.cpp \
@@ -169,6 +171,7 @@ SOURCES += \
 
 HEADERS += \
     algorithm/airwiresbuilder.h \
+    algorithm/polygonindex.h \
     alignment.h \
     application.h \
     attributes/attribute.h \
@@ -251,6 +254,7 @@ HEADERS += \
     graphics/graphicsview.h \
     graphics/holegraphicsitem.h \
     graphics/if_graphicsvieweventhandler.h \
+    graphics/levelofdetailpath.h \
     graphics/linegraphicsitem.h \
     graphics/origincrossgraphicsitem.h \
     graphics/polygongraphicsitem.h \
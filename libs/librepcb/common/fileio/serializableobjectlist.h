@@ -308,8 +308,8 @@ public:
   // General Methods
   int loadFromSExpression(const SExpression& node, const Version& fileFormat) {
     clear();
-    foreach (const SExpression& node, node.getChildren(P::tagname)) {
-      append(std::make_shared<T>(node, fileFormat));  // can throw
+    foreach (const SExpression* child, node.getChildrenByName(P::tagname)) {
+      append(std::make_shared<T>(*child, fileFormat));  // can throw
     }
     return count();
   }
@@ -31,22 +31,46 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Class SExpressionPath
+ ******************************************************************************/
+
+SExpressionPath::SExpressionPath(const QString& path) noexcept
+  : mPath(path), mSegments(), mValid(true) {
+  foreach (const QString& name, path.split('/')) {
+    Segment segment = {QString(), -1};
+    if (name.startsWith('@')) {
+      bool valid = false;
+      segment.index = name.mid(1).toInt(&valid);
+      if ((!valid) || (segment.index < 0)) {
+        mValid = false;
+      }
+    } else {
+      segment.name = name;
+    }
+    mSegments.append(segment);
+  }
+}
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
-SExpression::SExpression() noexcept : mType(Type::String) {
+SExpression::SExpression() noexcept
+  : mType(Type::String), mChildIndexValid(false) {
 }
 
 SExpression::SExpression(Type type, const QString& value)
-  : mType(type), mValue(value) {
+  : mType(type), mValue(value), mChildIndexValid(false) {
 }
 
 SExpression::SExpression(const SExpression& other) noexcept
   : mType(other.mType),
     mValue(other.mValue),
     mChildren(other.mChildren),
-    mFilePath(other.mFilePath) {
+    mFilePath(other.mFilePath),
+    mChildIndex(other.mChildIndex),
+    mChildIndexValid(other.mChildIndexValid) {
 }
 
 SExpression::~SExpression() noexcept {
@@ -85,9 +109,33 @@ const QString& SExpression::getValue() const {
 QList<SExpression> SExpression::getChildren(const QString& name) const
     noexcept {
   QList<SExpression> children;
-  foreach (const SExpression& child, mChildren) {
-    if (child.isList() && (child.mValue == name)) {
-      children.append(child);
+  if (mChildIndexValid) {
+    if (const QVector<int>* indices = getChildIndices(name)) {
+      foreach (int index, *indices) { children.append(mChildren.at(index)); }
+    }
+  } else {
+    foreach (const SExpression& child, mChildren) {
+      if (child.isList() && (child.mValue == name)) {
+        children.append(child);
+      }
+    }
+  }
+  return children;
+}
+
+QVector<const SExpression*> SExpression::getChildrenByName(
+    const QString& name) const noexcept {
+  QVector<const SExpression*> children;
+  if (mChildIndexValid) {
+    if (const QVector<int>* indices = getChildIndices(name)) {
+      children.reserve(indices->count());
+      foreach (int index, *indices) { children.append(&mChildren.at(index)); }
+    }
+  } else {
+    foreach (const SExpression& child, mChildren) {
+      if (child.isList() && (child.mValue == name)) {
+        children.append(&child);
+      }
     }
   }
   return children;
@@ -105,26 +153,54 @@ const SExpression& SExpression::getChild(const QString& path) const {
 
 const SExpression* SExpression::tryGetChild(const QString& path) const
     noexcept {
+  // Note: The path is not split into a list of strings to avoid memory
+  // allocations, since this method is called very often.
   const SExpression* child = this;
-  foreach (const QString& name, path.split('/')) {
-    if (name.startsWith('@')) {
-      bool valid = false;
-      int index = name.mid(1).toInt(&valid);
-      if ((valid) && (index >= 0) && (index < child->mChildren.count())) {
-        child = &child->mChildren.at(index);
+  int start = 0;
+  while (child) {
+    int end = path.indexOf('/', start);
+    if (end < 0) {
+      return child->tryGetDirectChild(path.midRef(start));
+    }
+    child = child->tryGetDirectChild(path.midRef(start, end - start));
+    start = end + 1;
+  }
+  return nullptr;
+}
+
+const SExpression& SExpression::getChild(const SExpressionPath& path) const {
+  const SExpression* child = tryGetChild(path);
+  if (child) {
+    return *child;
+  } else {
+    throw FileParseError(__FILE__, __LINE__, mFilePath, -1, -1, QString(),
+                         tr("Child not found: %1").arg(path.toStr()));
+  }
+}
+
+const SExpression* SExpression::tryGetChild(const SExpressionPath& path) const
+    noexcept {
+  if (!path.isValid()) {
+    return nullptr;
+  }
+  const SExpression* child = this;
+  foreach (const SExpressionPath::Segment& segment, path.getSegments()) {
+    if (segment.index >= 0) {
+      if (segment.index < child->mChildren.count()) {
+        child = &child->mChildren.at(segment.index);
       } else {
         return nullptr;
       }
-    } else {
-      bool found = false;
-      foreach (const SExpression& childchild, child->mChildren) {
-        if (childchild.isList() && (childchild.mValue == name)) {
-          child = &childchild;
-          found = true;
-          break;
-        }
+    } else if (child->mChildIndexValid) {
+      const QVector<int>* indices = child->getChildIndices(segment.name);
+      if (indices) {
+        child = &child->mChildren.at(indices->first());
+      } else {
+        return nullptr;
       }
-      if (!found) {
+    } else {
+      child = child->tryGetDirectChild(QStringRef(&segment.name));
+      if (!child) {
         return nullptr;
       }
     }
@@ -137,7 +213,7 @@ const SExpression* SExpression::tryGetChild(const QString& path) const
  ******************************************************************************/
 
 SExpression& SExpression::appendLineBreak() {
-  mChildren.append(createLineBreak());
+  mChildren.append(createLineBreak());  // does not affect the child index
   return *this;
 }
 
@@ -150,6 +226,13 @@ SExpression& SExpression::appendChild(const SExpression& child,
   if (mType == Type::List) {
     if (linebreak) appendLineBreak();
     mChildren.append(child);
+    if (mChildIndexValid) {
+      if (child.isList()) {
+        mChildIndex[child.mValue].append(mChildren.count() - 1);
+      }
+    } else if (mChildren.count() >= sChildIndexThreshold) {
+      updateChildIndex();
+    }
     return mChildren.last();
   } else {
     throw LogicError(__FILE__, __LINE__);
@@ -162,12 +245,14 @@ void SExpression::removeLineBreaks() noexcept {
       mChildren.removeAt(i);
     }
   }
+  updateChildIndex();
 }
 
 QByteArray SExpression::toByteArray() const {
-  QString str = toString(0);  // can throw
-  str += '\n';  // newline at end of file
-  return str.toUtf8();
+  QByteArray output;
+  writeTo(output, 0);  // can throw
+  output += '\n';  // newline at end of file
+  return output;
 }
 
 /*******************************************************************************
@@ -179,6 +264,8 @@ SExpression& SExpression::operator=(const SExpression& rhs) noexcept {
   mValue = rhs.mValue;
   mChildren = rhs.mChildren;
   mFilePath = rhs.mFilePath;
+  mChildIndex = rhs.mChildIndex;
+  mChildIndexValid = rhs.mChildIndexValid;
   return *this;
 }
 
@@ -186,10 +273,16 @@ SExpression& SExpression::operator=(const SExpression& rhs) noexcept {
  *  Private Methods
  ******************************************************************************/
 
-QString SExpression::escapeString(const QString& string) noexcept {
-  static QHash<QChar, QString> replacements;
-  if (replacements.isEmpty()) {
-    replacements = {
+QByteArray SExpression::escapeString(const QString& string) noexcept {
+  struct Replacements {
+    QHash<QChar, QString> map;
+    bool needsEscaping[0x80];  // lookup table for ASCII characters
+  };
+  // Initialized only once in a thread-safe way since strings are escaped
+  // concurrently by multiple threads (e.g. when saving files in parallel).
+  static const Replacements replacements = []() -> Replacements {
+    Replacements r = Replacements();  // zero-initializes the lookup table
+    r.map = {
         {'"', "\\\""},  // Double quote *must* be escaped
         {'\\', "\\\\"},  // Backslash *must* be escaped
         {'\b', "\\b"},  // Escape backspace to increase readability
@@ -205,16 +298,36 @@ QString SExpression::escapeString(const QString& string) noexcept {
       // modifying the file format in LibrePCB 0.1.6, we emulate the same
       // escaping behavior. In LibrePCB 0.2.x we are allowed to modify the file
       // format, so let's get rid of these legacy escaping behavior.
-      replacements.insert('\'', "\\\'");  // Single quote
-      replacements.insert('\?', "\\?");  // Question mark
-      replacements.insert('\a', "\\a");  // Audible bell
+      r.map.insert('\'', "\\\'");  // Single quote
+      r.map.insert('\?', "\\?");  // Question mark
+      r.map.insert('\a', "\\a");  // Audible bell
+    }
+    foreach (const QChar& c, r.map.keys()) {
+      Q_ASSERT(c.unicode() < 0x80);
+      r.needsEscaping[c.unicode()] = true;
+    }
+    return r;
+  }();
+
+  // Fast path: Most strings do not contain any characters to be escaped, so
+  // they can be converted to UTF-8 without building an escaped copy first.
+  bool escapingRequired = false;
+  foreach (const QChar& c, string) {
+    if ((c.unicode() < 0x80) && replacements.needsEscaping[c.unicode()]) {
+      escapingRequired = true;
+      break;
     }
   }
+  if (!escapingRequired) {
+    return string.toUtf8();
+  }
 
   QString escaped;
   escaped.reserve(string.length() + (string.length() / 10));
-  foreach (const QChar& c, string) { escaped += replacements.value(c, c); }
-  return escaped;
+  foreach (const QChar& c, string) {
+    escaped += replacements.map.value(c, c);
+  }
+  return escaped.toUtf8();
 }
 
 bool SExpression::isValidToken(const QString& token) noexcept {
@@ -230,22 +343,29 @@ bool SExpression::isValidToken(const QString& token) noexcept {
 }
 
 bool SExpression::isValidTokenChar(const QChar& c) noexcept {
-  static QSet<QChar> allowedSpecialChars = {'\\', '.', ':', '_', '-'};
+  return (c.unicode() < 0x80) &&
+      isValidTokenChar(static_cast<char>(c.unicode()));
+}
+
+bool SExpression::isValidTokenChar(char c) noexcept {
   return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
-      ((c >= '0') && (c <= '9')) || allowedSpecialChars.contains(c);
+      ((c >= '0') && (c <= '9')) || (c == '\\') || (c == '.') || (c == ':') ||
+      (c == '_') || (c == '-');
 }
 
-QString SExpression::toString(int indent) const {
+void SExpression::writeTo(QByteArray& output, int indent) const {
   if (mType == Type::List) {
     if (!isValidToken(mValue)) {
       throw LogicError(__FILE__, __LINE__,
                        tr("Invalid S-Expression list name: %1").arg(mValue));
     }
-    QString str = '(' + mValue;
+    output += '(';
+    output += mValue.toLatin1();  // a valid token contains only ASCII chars
     for (int i = 0; i < mChildren.count(); ++i) {
       const SExpression& child = mChildren.at(i);
-      if ((!str.at(str.length() - 1).isSpace()) && (!child.isLineBreak())) {
-        str += ' ';
+      const char lastChar = output.at(output.length() - 1);
+      if ((lastChar != ' ') && (lastChar != '\n') && (!child.isLineBreak())) {
+        output += ' ';
       }
       bool nextChildIsLineBreak = (i < mChildren.count() - 1)
           ? mChildren.at(i + 1).isLineBreak()
@@ -254,31 +374,79 @@ QString SExpression::toString(int indent) const {
         if ((i > 0) && mChildren.at(i - 1).isLineBreak()) {
           // too many line breaks ;)
         } else {
-          str += '\n';
+          output += '\n';
         }
       } else {
-        str += child.toString(indent + 1);
+        child.writeTo(output, indent + 1);
       }
     }
     if (isMultiLineList()) {
-      str += '\n' + QString(' ').repeated(indent);
+      output += '\n';
+      output.append(QByteArray(indent, ' '));
     }
-    return str + ')';
+    output += ')';
   } else if (mType == Type::Token) {
     if (!isValidToken(mValue)) {
       throw LogicError(__FILE__, __LINE__,
                        tr("Invalid S-Expression token: %1").arg(mValue));
     }
-    return mValue;
+    output += mValue.toLatin1();  // a valid token contains only ASCII chars
   } else if (mType == Type::String) {
-    return '"' + escapeString(mValue) + '"';
+    output += '"';
+    output += escapeString(mValue);
+    output += '"';
   } else if (mType == Type::LineBreak) {
-    return '\n' + QString(' ').repeated(indent);
+    output += '\n';
+    output.append(QByteArray(indent, ' '));
   } else {
     throw LogicError(__FILE__, __LINE__);
   }
 }
 
+const SExpression* SExpression::tryGetDirectChild(
+    const QStringRef& segment) const noexcept {
+  if (segment.startsWith('@')) {
+    bool valid = false;
+    int index =
+        QStringRef(segment.string(), segment.position() + 1, segment.size() - 1)
+            .toInt(&valid);
+    if ((valid) && (index >= 0) && (index < mChildren.count())) {
+      return &mChildren.at(index);
+    }
+  } else if (mChildIndexValid) {
+    if (const QVector<int>* indices = getChildIndices(segment.toString())) {
+      return &mChildren.at(indices->first());
+    }
+  } else {
+    foreach (const SExpression& child, mChildren) {
+      if (child.isList() && (child.mValue == segment)) {
+        return &child;
+      }
+    }
+  }
+  return nullptr;
+}
+
+const QVector<int>* SExpression::getChildIndices(const QString& name) const
+    noexcept {
+  Q_ASSERT(mChildIndexValid);
+  auto it = mChildIndex.constFind(name);
+  return (it != mChildIndex.constEnd()) ? &it.value() : nullptr;
+}
+
+void SExpression::updateChildIndex() noexcept {
+  mChildIndex.clear();
+  mChildIndexValid = (mChildren.count() >= sChildIndexThreshold);
+  if (mChildIndexValid) {
+    for (int i = 0; i < mChildren.count(); ++i) {
+      const SExpression& child = mChildren.at(i);
+      if (child.isList()) {
+        mChildIndex[child.mValue].append(i);
+      }
+    }
+  }
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
@@ -301,119 +469,233 @@ SExpression SExpression::createLineBreak() {
 
 SExpression SExpression::parse(const QByteArray& content,
                                const FilePath& filePath) {
+  return parseDocument(content, filePath, nullptr);
+}
+
+SExpression SExpression::parseFiltered(const QByteArray& content,
+                                       const FilePath& filePath,
+                                       const QSet<QString>& rootChildren) {
+  return parseDocument(content, filePath, &rootChildren);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+SExpression SExpression::parseDocument(const QByteArray& content,
+                                       const FilePath& filePath,
+                                       const QSet<QString>* rootChildren) {
+  // Note: The content is tokenized directly on the UTF-8 encoded bytes, i.e.
+  // without converting the whole file to UTF-16 first. Only the values of
+  // the created nodes are decoded, which is much faster for large files.
   int index = 0;
-  QString contentStr = QString::fromUtf8(content);
-  skipWhitespaceAndComments(contentStr, index);
-  if (index >= contentStr.length()) {
+  if (content.startsWith("\xEF\xBB\xBF")) {
+    index = 3;  // skip UTF-8 BOM (skipped by QString::fromUtf8() as well)
+  }
+  skipWhitespaceAndComments(content, index);
+  if (index >= content.length()) {
     throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
                          "No S-Expression node found.");
   }
-  SExpression root = parse(contentStr, index, filePath);
-  if (index < contentStr.length()) {
+  SExpression root = (rootChildren && (content.at(index) == '('))
+      ? parseList(content, index, filePath, rootChildren)
+      : parse(content, index, filePath);
+  if (index < content.length()) {
     throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
                          "File contains more than one root node.");
   }
   return root;
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
-SExpression SExpression::parse(const QString& content, int& index,
+SExpression SExpression::parse(const QByteArray& content, int& index,
                                const FilePath& filePath) {
   Q_ASSERT(index < content.length());
 
-  if (content.at(index) == '(') {
+  const char c = content.constData()[index];
+  if (c == '(') {
     return parseList(content, index, filePath);
-  } else if (content.at(index) == '"') {
-    return createString(parseString(content, index, filePath));
+  } else if (c == '"') {
+    SExpression string(Type::String, parseString(content, index, filePath));
+    string.mFilePath = filePath;
+    return string;
   } else {
-    return createToken(parseToken(content, index, filePath));
+    SExpression token(Type::Token, parseToken(content, index, filePath));
+    token.mFilePath = filePath;
+    return token;
   }
 }
 
-SExpression SExpression::parseList(const QString& content, int& index,
-                                   const FilePath& filePath) {
+SExpression SExpression::parseList(const QByteArray& content, int& index,
+                                   const FilePath& filePath,
+                                   const QSet<QString>* children) {
   Q_ASSERT((index < content.length()) && (content.at(index) == '('));
 
   ++index;  // consume the '('
 
-  SExpression list = createList(parseToken(content, index, filePath));
+  SExpression list(Type::List, parseToken(content, index, filePath));
+  list.mFilePath = filePath;
 
+  const char* data = content.constData();
+  const int length = content.length();
   while (true) {
-    if (index >= content.length()) {
+    if (index >= length) {
       throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
                            "S-Expression node ended without closing ')'.");
     }
-    if (content.at(index) == ')') {
+    if (data[index] == ')') {
       ++index;  // consume the ')'
       skipWhitespaceAndComments(content, index);  // consume following spaces
       break;
+    } else if (children && (data[index] == '(')) {
+      int nameIndex = index + 1;
+      if (children->contains(parseToken(content, nameIndex, filePath))) {
+        list.mChildren.append(parseList(content, index, filePath));
+      } else {
+        skipList(content, index, filePath);
+      }
     } else {
-      list.appendChild(parse(content, index, filePath));
+      list.mChildren.append(parse(content, index, filePath));
     }
   }
 
+  list.updateChildIndex();
   return list;
 }
 
-QString SExpression::parseToken(const QString& content, int& index,
+void SExpression::skipList(const QByteArray& content, int& index,
+                           const FilePath& filePath) {
+  Q_ASSERT((index < content.length()) && (content.at(index) == '('));
+
+  const char* data = content.constData();
+  const int length = content.length();
+  int depth = 0;
+  while (index < length) {
+    const char c = data[index];
+    if (c == '"') {
+      ++index;  // consume the '"'
+      while ((index < length) && (data[index] != '"')) {
+        if (data[index] == '\\') ++index;  // skip escaped character
+        ++index;
+      }
+      if (index >= length) {
+        throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                             "String ended without quote.");
+      }
+    } else if (c == ';') {
+      while ((index < length) && (data[index] != '\n')) ++index;
+      continue;
+    } else if (c == '(') {
+      ++depth;
+    } else if ((c == ')') && (--depth == 0)) {
+      ++index;  // consume the ')'
+      skipWhitespaceAndComments(content, index);  // consume following spaces
+      return;
+    }
+    ++index;
+  }
+  throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
+                       "S-Expression node ended without closing ')'.");
+}
+
+QString SExpression::parseToken(const QByteArray& content, int& index,
                                 const FilePath& filePath) {
+  const char* data = content.constData();
+  const int length = content.length();
   int oldIndex = index;
-  while ((index < content.length()) && (isValidTokenChar(content.at(index)))) {
+  while ((index < length) && (isValidTokenChar(data[index]))) {
     ++index;
   }
-  QString token = content.mid(oldIndex, index - oldIndex);
-  if (token.isEmpty()) {
+  if (index == oldIndex) {
     throw FileParseError(
         __FILE__, __LINE__, filePath, -1, -1, QString(),
         QString("Invalid token character detected: '%1'")
-            .arg(index < content.length() ? content.at(index) : QChar()));
+            .arg(index < length ? QString::fromUtf8(data + index, 1)
+                                : QString()));
   }
+  // Tokens consist of ASCII characters only, so no UTF-8 decoding is needed.
+  QString token = QString::fromLatin1(data + oldIndex, index - oldIndex);
   skipWhitespaceAndComments(content, index);  // consume following spaces
   return token;
 }
 
-QString SExpression::parseString(const QString& content, int& index,
+QString SExpression::parseString(const QByteArray& content, int& index,
                                  const FilePath& filePath) {
   ++index;  // consume the '"'
 
-  // Note: Until LibrePCB 0.1.5 we used the sexpresso library for escaping
-  // strings. This library escaped more characters than we do now. To still
-  // support reading the file format 0.1, we have to keep support for the
-  // old escaping behavior.
-  static QHash<QChar, QChar> escapedChars = {
-      {'\'', '\''},  // Single quote
-      {'"', '"'},  // Double quote
-      {'?', '\?'},  // Question mark
-      {'\\', '\\'},  // Backslash
-      {'a', '\a'},  // Audible bell
-      {'b', '\b'},  // Backspace
-      {'f', '\f'},  // Form feed
-      {'n', '\n'},  // Line feed
-      {'r', '\r'},  // Carriage return
-      {'t', '\t'},  // Horizontal tab
-      {'v', '\v'},  // Vertical tab
-  };
+  const char* data = content.constData();
+  const int length = content.length();
 
-  QString string;
+  // Fast path: Most strings do not contain any escape sequences, so they can
+  // be decoded in one step without building up an intermediate buffer.
+  int end = index;
+  while ((end < length) && (data[end] != '"') && (data[end] != '\\')) {
+    ++end;
+  }
+  if ((end < length) && (data[end] == '"')) {
+    QString string = QString::fromUtf8(data + index, end - index);
+    index = end + 1;  // consume the '"'
+    skipWhitespaceAndComments(content, index);  // consume following spaces
+    return string;
+  }
+
+  // Slow path: The string contains escape sequences. Note that until LibrePCB
+  // 0.1.5 we used the sexpresso library for escaping strings. This library
+  // escaped more characters than we do now. To still support reading the file
+  // format 0.1, we have to keep support for the old escaping behavior.
+  QByteArray string(data + index, end - index);
+  index = end;
   bool escaped = false;
   while (true) {
-    if (index >= content.length()) {
+    if (index >= length) {
       throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
                            "String ended without quote.");
     }
-    const QChar& c = content.at(index);
+    const char c = data[index];
     if (escaped) {
-      if (escapedChars.contains(c)) {
-        string += escapedChars[c];
-        ++index;
-        escaped = false;
-      } else {
-        throw FileParseError(__FILE__, __LINE__, filePath, -1, -1, QString(),
-                             QString("Illegal escape sequence: '\\%1'").arg(c));
+      char unescaped = 0;
+      switch (c) {
+        case '\'':  // Single quote
+          unescaped = '\'';
+          break;
+        case '"':  // Double quote
+          unescaped = '"';
+          break;
+        case '?':  // Question mark
+          unescaped = '\?';
+          break;
+        case '\\':  // Backslash
+          unescaped = '\\';
+          break;
+        case 'a':  // Audible bell
+          unescaped = '\a';
+          break;
+        case 'b':  // Backspace
+          unescaped = '\b';
+          break;
+        case 'f':  // Form feed
+          unescaped = '\f';
+          break;
+        case 'n':  // Line feed
+          unescaped = '\n';
+          break;
+        case 'r':  // Carriage return
+          unescaped = '\r';
+          break;
+        case 't':  // Horizontal tab
+          unescaped = '\t';
+          break;
+        case 'v':  // Vertical tab
+          unescaped = '\v';
+          break;
+        default:
+          throw FileParseError(
+              __FILE__, __LINE__, filePath, -1, -1, QString(),
+              QString("Illegal escape sequence: '\\%1'")
+                  .arg(QString::fromUtf8(data + index, 1)));
       }
+      string += unescaped;
+      ++index;
+      escaped = false;
     } else if (c == '"') {
       ++index;  // consume the '"'
       skipWhitespaceAndComments(content, index);  // consume following spaces
@@ -426,22 +708,23 @@ QString SExpression::parseString(const QString& content, int& index,
       ++index;
     }
   }
-  return string;
+  return QString::fromUtf8(string);
 }
 
-void SExpression::skipWhitespaceAndComments(const QString& content,
-                                            int& index) {
-  static QSet<QChar> spaces = {' ', '\f', '\n', '\r', '\t', '\v'};
-
+void SExpression::skipWhitespaceAndComments(const QByteArray& content,
+                                            int& index) noexcept {
+  const char* data = content.constData();
+  const int length = content.length();
   bool isComment = false;
-  while (index < content.length()) {
-    const QChar& c = content.at(index);
+  while (index < length) {
+    const char c = data[index];
     if (c == ';') {  // Line-comment of the Lisp language
       isComment = true;
     } else if (c == '\n') {
       isComment = false;
     }
-    if (isComment || spaces.contains(c)) {
+    if (isComment || (c == ' ') || (c == '\f') || (c == '\n') || (c == '\r') ||
+        (c == '\t') || (c == '\v')) {
       ++index;
     } else {
       break;
@@ -62,6 +62,45 @@ SExpression serialize(const T& obj);
 template <typename T>
 T deserialize(const SExpression& sexpr, const Version& fileFormat);
 
+/*******************************************************************************
+ *  Class SExpressionPath
+ ******************************************************************************/
+
+/**
+ * @brief A precompiled path to a (nested) child of a ::librepcb::SExpression
+ *
+ * See ::librepcb::SExpression::getChild() for the syntax of paths. The path
+ * string is split and parsed only once, so the same object can be reused for
+ * many lookups (e.g. when deserializing thousands of elements of same type).
+ */
+class SExpressionPath final {
+public:
+  // Types
+  struct Segment {
+    QString name;  ///< list name (only if index is negative)
+    int index;  ///< child index, or -1 to look up by name
+  };
+
+  // Constructors / Destructor
+  SExpressionPath() = delete;
+  SExpressionPath(const SExpressionPath& other) = default;
+  explicit SExpressionPath(const QString& path) noexcept;
+  ~SExpressionPath() noexcept {}
+
+  // Getters
+  bool isValid() const noexcept { return mValid; }
+  const QString& toStr() const noexcept { return mPath; }
+  const QVector<Segment>& getSegments() const noexcept { return mSegments; }
+
+  // Operator Overloadings
+  SExpressionPath& operator=(const SExpressionPath& rhs) = default;
+
+private:  // Data
+  QString mPath;
+  QVector<Segment> mSegments;
+  bool mValid;  ///< false if the path contains invalid child indices
+};
+
 /*******************************************************************************
  *  Class SExpression
  ******************************************************************************/
@@ -99,6 +138,19 @@ public:
   const QList<SExpression>& getChildren() const noexcept { return mChildren; }
   QList<SExpression> getChildren(const QString& name) const noexcept;
 
+  /**
+   * @brief Get all list children with a specific name, without copying them
+   *
+   * In contrast to #getChildren(const QString&), the children are not copied.
+   * The returned pointers are valid as long as this node is not modified.
+   *
+   * @param name    The list name of the children to get.
+   *
+   * @return Pointers to all matching children, in the order of appearance.
+   */
+  QVector<const SExpression*> getChildrenByName(const QString& name) const
+      noexcept;
+
   /**
    * @brief Get a child by path
    *
@@ -147,6 +199,17 @@ public:
    */
   const SExpression* tryGetChild(const QString& path) const noexcept;
 
+  /**
+   * @brief Same as #getChild(const QString&) const, but with a precompiled path
+   */
+  const SExpression& getChild(const SExpressionPath& path) const;
+
+  /**
+   * @brief Same as #tryGetChild(const QString&) const, but with a precompiled
+   *        path
+   */
+  const SExpression* tryGetChild(const SExpressionPath& path) const noexcept;
+
   // General Methods
   SExpression& appendLineBreak();
   SExpression& appendList(const QString& name, bool linebreak);
@@ -171,30 +234,89 @@ public:
   static SExpression createToken(const QString& token);
   static SExpression createString(const QString& string);
   static SExpression createLineBreak();
+
+  /**
+   * @brief Parse an S-Expression document
+   *
+   * The content is tokenized directly on its UTF-8 bytes, only the values of
+   * the created nodes get decoded. All created nodes share the same (implicitly
+   * shared) file path, which is used for error messages.
+   *
+   * @param content   The UTF-8 encoded file content.
+   * @param filePath  The path of the parsed file (only used for messages).
+   *
+   * @return The root node of the parsed document.
+   *
+   * @throws ::librepcb::FileParseError if the content is not valid.
+   */
   static SExpression parse(const QByteArray& content, const FilePath& filePath);
 
+  /**
+   * @brief Parse only some child lists of the root node of a document
+   *
+   * Same as #parse(), but child lists of the root node whose name is not
+   * contained in `rootChildren` are skipped without creating any nodes. This
+   * is much faster if only a few small nodes of a large document are needed,
+   * for example the metadata of a library element. Tokens and strings of the
+   * root node are always kept.
+   *
+   * @param content       The UTF-8 encoded file content.
+   * @param filePath      The path of the parsed file (only used for messages).
+   * @param rootChildren  Names of the child lists of the root node to parse.
+   *
+   * @return The root node containing only the requested child lists.
+   *
+   * @throws ::librepcb::FileParseError if the content is not valid. Note that
+   *         skipped lists are only checked for balanced braces and quotes.
+   */
+  static SExpression parseFiltered(const QByteArray& content,
+                                   const FilePath& filePath,
+                                   const QSet<QString>& rootChildren);
+
 private:  // Methods
   SExpression(Type type, const QString& value);
 
-  static SExpression parse(const QString& content, int& index,
+  static SExpression parseDocument(const QByteArray& content,
+                                   const FilePath& filePath,
+                                   const QSet<QString>* rootChildren);
+  static SExpression parse(const QByteArray& content, int& index,
                            const FilePath& filePath);
-  static SExpression parseList(const QString& content, int& index,
-                               const FilePath& filePath);
-  static QString parseToken(const QString& content, int& index,
+  static SExpression parseList(const QByteArray& content, int& index,
+                               const FilePath& filePath,
+                               const QSet<QString>* children = nullptr);
+  static void skipList(const QByteArray& content, int& index,
+                       const FilePath& filePath);
+  static QString parseToken(const QByteArray& content, int& index,
                             const FilePath& filePath);
-  static QString parseString(const QString& content, int& index,
+  static QString parseString(const QByteArray& content, int& index,
                              const FilePath& filePath);
-  static void skipWhitespaceAndComments(const QString& content, int& index);
-  static QString escapeString(const QString& string) noexcept;
+  static void skipWhitespaceAndComments(const QByteArray& content,
+                                        int& index) noexcept;
+  static QByteArray escapeString(const QString& string) noexcept;
   static bool isValidToken(const QString& token) noexcept;
   static bool isValidTokenChar(const QChar& c) noexcept;
-  QString toString(int indent) const;
+  static bool isValidTokenChar(char c) noexcept;
+  void writeTo(QByteArray& output, int indent) const;
+  const SExpression* tryGetDirectChild(const QStringRef& segment) const
+      noexcept;
+  const QVector<int>* getChildIndices(const QString& name) const noexcept;
+  void updateChildIndex() noexcept;
 
 private:  // Data
   Type mType;
   QString mValue;  ///< either a list name, a token or a string
   QList<SExpression> mChildren;
   FilePath mFilePath;
+
+  /// Index of list children: Name -> Indices in #mChildren
+  ///
+  /// Only built for lists with many children (see #sChildIndexThreshold)
+  /// since a linear search is faster for small lists. The index is always
+  /// kept up to date when modifying the children (never built lazily by
+  /// getters), so const nodes can safely be read from multiple threads.
+  QHash<QString, QVector<int>> mChildIndex;
+  bool mChildIndexValid;  ///< Whether #mChildIndex is built
+  static const int sChildIndexThreshold = 16;
 };
 
 /*******************************************************************************
@@ -173,7 +173,13 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
   if (mModifiedFiles.contains(cleanedPath)) {
     return mModifiedFiles.value(cleanedPath);
   } else if (!isRemoved(cleanedPath)) {
-    return FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    QByteArray content =
+        FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    if (mIsWritable) {
+      // read-only file systems are never saved, so don't waste time hashing
+      rememberDiskFile(cleanedPath, content);
+    }
+    return content;
   } else {
     throw RuntimeError(__FILE__, __LINE__,
                        tr("File '%1' does not exist.")
@@ -309,12 +315,17 @@ QStringList TransactionalFileSystem::checkForModifications() const {
     }
   }
 
-  // new or modified files
+  // new or modified files (only read from disk if the hash is not known)
   foreach (const QString& filepath, mModifiedFiles.keys()) {
     FilePath fp = mFilePath.getPathTo(filepath);
     QByteArray content = mModifiedFiles.value(filepath);
-    if ((!fp.isExistingFile()) ||
-        (FileUtils::readFile(fp) != content)) {  // can throw
+    QByteArray hash = getDiskFileHash(filepath);
+    if (!hash.isNull()) {
+      if (calcHash(content) != hash) {
+        modifications.append(filepath);
+      }
+    } else if ((!fp.isExistingFile()) ||
+               (FileUtils::readFile(fp) != content)) {  // can throw
       modifications.append(filepath);
     }
   }
@@ -323,10 +334,14 @@ QStringList TransactionalFileSystem::checkForModifications() const {
 }
 
 void TransactionalFileSystem::autosave() {
+  discardUnchangedFiles();
   saveDiff("autosave");  // can throw
 }
 
 void TransactionalFileSystem::save() {
+  // files written with the same content as on disk don't need to be saved
+  discardUnchangedFiles();
+
   // save to backup directory
   saveDiff("backup");  // can throw
 
@@ -344,6 +359,7 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingDir()) {
       FileUtils::removeDirRecursively(fp);  // can throw
     }
+    forgetDiskFiles(dir);
   }
 
   // remove files
@@ -352,12 +368,14 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingFile()) {
       FileUtils::removeFile(fp);  // can throw
     }
+    forgetDiskFiles(filepath);
   }
 
   // save new or modified files
   foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FileUtils::writeFile(mFilePath.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+    QByteArray content = mModifiedFiles.value(filepath);
+    FileUtils::writeFile(mFilePath.getPathTo(filepath), content);  // can throw
+    rememberDiskFile(filepath, content);
   }
 
   // remove backup
@@ -397,6 +415,68 @@ bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
   return false;
 }
 
+QByteArray TransactionalFileSystem::getDiskFileHash(const QString& path) const
+    noexcept {
+  QMutexLocker locker(&mDiskFilesMutex);
+  auto it = mDiskFiles.find(path);
+  if (it == mDiskFiles.end()) {
+    return QByteArray();
+  }
+
+  // the hash is only valid if the file was not modified on disk in the meantime
+  QFileInfo info(mFilePath.getPathTo(path).toStr());
+  if ((!info.isFile()) || (info.size() != it->size) ||
+      (info.lastModified() != it->lastModified)) {
+    mDiskFiles.erase(it);
+    return QByteArray();
+  }
+  return it->hash;
+}
+
+void TransactionalFileSystem::rememberDiskFile(const QString& path,
+                                               const QByteArray& content) const
+    noexcept {
+  QFileInfo info(mFilePath.getPathTo(path).toStr());
+  DiskFile file{calcHash(content), info.size(), info.lastModified()};
+  QMutexLocker locker(&mDiskFilesMutex);
+  if (info.isFile() && (info.size() == content.size())) {
+    mDiskFiles.insert(path, file);
+  } else {
+    mDiskFiles.remove(path);  // modified on disk while reading it
+  }
+}
+
+void TransactionalFileSystem::forgetDiskFiles(const QString& path) noexcept {
+  // directory paths are either empty (root) or end with a slash
+  bool isDir = path.isEmpty() || path.endsWith('/');
+  QMutexLocker locker(&mDiskFilesMutex);
+  for (auto it = mDiskFiles.begin(); it != mDiskFiles.end();) {
+    if (isDir ? it.key().startsWith(path) : (it.key() == path)) {
+      it = mDiskFiles.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void TransactionalFileSystem::discardUnchangedFiles() noexcept {
+  foreach (const QString& filepath, mModifiedFiles.keys()) {
+    // Files within removed directories must be kept since the directory gets
+    // removed before the modified files are written.
+    if (isRemoved(filepath)) continue;
+    QByteArray hash = getDiskFileHash(filepath);
+    QByteArray content = mModifiedFiles.value(filepath);
+    if ((!hash.isNull()) && (calcHash(content) == hash)) {
+      mModifiedFiles.remove(filepath);
+    }
+  }
+}
+
+QByteArray TransactionalFileSystem::calcHash(
+    const QByteArray& content) noexcept {
+  return QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+}
+
 void TransactionalFileSystem::exportDirToZip(QuaZipFile& file,
                                              const FilePath& zipFp,
                                              const QString& dir) const {
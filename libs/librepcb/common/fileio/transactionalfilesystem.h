@@ -59,6 +59,10 @@ namespace librepcb {
  *  - Holds all file modifications in memory and allows to write those in an
  *    atomic way to the disk (see @ref doc_project_save).
  *  - Allows to export the whole file system to a ZIP file.
+ *  - Remembers a content hash of every file read from disk, so files which
+ *    were written with unchanged content are neither backed up nor rewritten
+ *    when saving, and #checkForModifications() does not need to read them
+ *    again.
  */
 class TransactionalFileSystem final : public FileSystem {
   Q_OBJECT
@@ -187,6 +191,12 @@ public:
 
 private:  // Methods
   bool isRemoved(const QString& path) const noexcept;
+  QByteArray getDiskFileHash(const QString& path) const noexcept;
+  void rememberDiskFile(const QString& path, const QByteArray& content) const
+      noexcept;
+  void forgetDiskFiles(const QString& path) noexcept;
+  void discardUnchangedFiles() noexcept;
+  static QByteArray calcHash(const QByteArray& content) noexcept;
   void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
                       const QString& dir) const;
   void saveDiff(const QString& type) const;
@@ -203,6 +213,21 @@ private:  // Data
   QHash<QString, QByteArray> mModifiedFiles;
   QSet<QString> mRemovedFiles;
   QSet<QString> mRemovedDirs;
+
+  /**
+   * @brief State of files on disk, as they were read or written
+   *
+   * The size and modification time are used to detect files which were
+   * modified on disk in the meantime, so their hash is no longer valid.
+   */
+  struct DiskFile {
+    QByteArray hash;
+    qint64 size;
+    QDateTime lastModified;
+  };
+  /// Files read from disk (only if writable), key: Relative file path
+  mutable QHash<QString, DiskFile> mDiskFiles;
+  mutable QMutex mDiskFilesMutex;  ///< read() may be called from many threads
 };
 
 /*******************************************************************************
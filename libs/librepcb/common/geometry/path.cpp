@@ -40,8 +40,8 @@ Path::Path(const Path& other) noexcept
 }
 
 Path::Path(const SExpression& node, const Version& fileFormat) {
-  foreach (const SExpression& child, node.getChildren("vertex")) {
-    mVertices.append(Vertex(child, fileFormat));
+  foreach (const SExpression* child, node.getChildrenByName("vertex")) {
+    mVertices.append(Vertex(*child, fileFormat));
   }
 }
 
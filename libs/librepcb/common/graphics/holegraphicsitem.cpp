@@ -70,6 +70,16 @@ HoleGraphicsItem::~HoleGraphicsItem() noexcept {
  *  Inherited from QGraphicsItem
  ******************************************************************************/
 
+QRectF HoleGraphicsItem::boundingRect() const noexcept {
+  // must contain the whole shape, since items are looked up by their bounding
+  // rect
+  QRectF rect = PrimitiveCircleGraphicsItem::boundingRect();
+  if (mOriginCrossGraphicsItem) {
+    rect = rect.united(mOriginCrossGraphicsItem->boundingRect());
+  }
+  return rect;
+}
+
 QPainterPath HoleGraphicsItem::shape() const noexcept {
   return PrimitiveCircleGraphicsItem::shape() +
       mOriginCrossGraphicsItem->shape();
@@ -86,9 +96,10 @@ void HoleGraphicsItem::holeEdited(const Hole& hole,
       setPosition(hole.getPosition());
       break;
     case Hole::Event::DiameterChanged:
-      setDiameter(positiveToUnsigned(hole.getDiameter()));
+      prepareGeometryChange();  // the origin cross is part of the bounding rect
       mOriginCrossGraphicsItem->setSize(positiveToUnsigned(hole.getDiameter()) +
                                         UnsignedLength(500000));
+      setDiameter(positiveToUnsigned(hole.getDiameter()));
       break;
     default:
       qWarning() << "Unhandled switch-case in HoleGraphicsItem::holeEdited()";
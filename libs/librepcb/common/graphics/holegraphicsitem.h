@@ -58,6 +58,7 @@ public:
   const Hole& getHole() noexcept { return mHole; }
 
   // Inherited from QGraphicsItem
+  QRectF boundingRect() const noexcept override;
   QPainterPath shape() const noexcept override;
 
   // Operator Overloadings
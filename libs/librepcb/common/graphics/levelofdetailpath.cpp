@@ -0,0 +1,220 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "levelofdetailpath.h"
+
+#include <QtCore>
+#include <QtWidgets>
+
+#include <cmath>
+#include <limits>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+// Above this level of detail, the original path is drawn.
+const qreal LevelOfDetailPath::sMaxSimplifiedLevelOfDetail = 8;
+
+// Paths smaller than this (in device pixels) are drawn as bounding rect.
+const qreal LevelOfDetailPath::sTinySizePx = 1;
+
+// Maximum deviation of simplified paths (in device pixels at the lowest level
+// of detail of a zoom band, i.e. at most twice this value on screen).
+const qreal LevelOfDetailPath::sTolerancePx = 0.25;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LevelOfDetailPath::LevelOfDetailPath() noexcept
+  : mPath(), mBoundingRect(), mSimplifiedPaths() {
+}
+
+LevelOfDetailPath::LevelOfDetailPath(const LevelOfDetailPath& other) noexcept
+  : mPath(other.mPath),
+    mBoundingRect(other.mBoundingRect),
+    mSimplifiedPaths(other.mSimplifiedPaths) {
+}
+
+LevelOfDetailPath::LevelOfDetailPath(const QPainterPath& path) noexcept
+  : mPath(path), mBoundingRect(path.boundingRect()), mSimplifiedPaths() {
+}
+
+LevelOfDetailPath::~LevelOfDetailPath() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+bool LevelOfDetailPath::isTiny(qreal lod) const noexcept {
+  qreal size = qMax(mBoundingRect.width(), mBoundingRect.height());
+  return (!mPath.isEmpty()) && (size * lod < sTinySizePx);
+}
+
+QPainterPath LevelOfDetailPath::getSimplifiedPath(qreal lod) const noexcept {
+  if ((!(lod > 0)) || (!(lod < sMaxSimplifiedLevelOfDetail))) {
+    return mPath;  // also catches infinity and NaN
+  }
+
+  // all levels of detail within [2^band, 2^(band+1)) share the same path
+  int band = static_cast<int>(std::floor(std::log2(lod)));
+  auto it = mSimplifiedPaths.constFind(band);
+  if (it != mSimplifiedPaths.constEnd()) {
+    return *it;
+  }
+
+  // flatten curves in device pixels, i.e. with the required precision
+  qreal scale = std::ldexp(qreal(1), band);
+  QTransform toDevice = QTransform::fromScale(scale, scale);
+  QTransform toScene = QTransform::fromScale(1 / scale, 1 / scale);
+  QPainterPath simplified;
+  simplified.setFillRule(mPath.fillRule());
+  foreach (const QPolygonF& polygon, mPath.toSubpathPolygons(toDevice)) {
+    QPolygonF polyline = simplifyPolyline(polygon, sTolerancePx);
+    if (polygon.isClosed() && (polyline.count() < 4)) {
+      // collapsed area, keep it visible as a rect of the original size
+      simplified.addRect(toScene.mapRect(polygon.boundingRect()));
+    } else {
+      simplified.addPolygon(toScene.map(polyline));
+      if (polygon.isClosed()) simplified.closeSubpath();
+    }
+  }
+  mSimplifiedPaths.insert(band, simplified);
+  return simplified;
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void LevelOfDetailPath::setPath(const QPainterPath& path) noexcept {
+  mPath = path;
+  mBoundingRect = path.boundingRect();
+  mSimplifiedPaths.clear();
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void LevelOfDetailPath::draw(QPainter& painter, qreal lod) const noexcept {
+  if (isTiny(lod)) {
+    painter.drawRect(mBoundingRect);
+  } else {
+    painter.drawPath(getSimplifiedPath(lod));
+  }
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+qreal LevelOfDetailPath::getLevelOfDetail(
+    const QPainter& painter, const QStyleOptionGraphicsItem& option) noexcept {
+  QPaintDevice* device = painter.device();
+  switch (device ? device->devType() : int(QInternal::UnknownDevice)) {
+    case QInternal::Widget:  // graphics view viewport
+    case QInternal::Pixmap:  // cached graphics items
+    case QInternal::OpenGL:  // OpenGL viewport
+      return option.levelOfDetailFromTransform(painter.worldTransform());
+    default:  // printer, SVG generator, image etc.
+      return std::numeric_limits<qreal>::infinity();
+  }
+}
+
+QPolygonF LevelOfDetailPath::simplifyPolyline(const QPolygonF& polyline,
+                                              qreal tolerance) noexcept {
+  const int count = polyline.count();
+  if (count < 3) {
+    return polyline;
+  }
+
+  // iterative Douglas-Peucker to avoid deep recursion on huge polylines
+  const qreal tolerance2 = tolerance * tolerance;
+  QVector<bool> keep(count, false);
+  keep[0] = true;
+  keep[count - 1] = true;
+  QVector<QPair<int, int>> stack;
+  stack.append(qMakePair(0, count - 1));
+  while (!stack.isEmpty()) {
+    QPair<int, int> range = stack.takeLast();
+    const QPointF& a = polyline.at(range.first);
+    const QPointF& b = polyline.at(range.second);
+    qreal maxDistance2 = 0;
+    int farthest = -1;
+    for (int i = range.first + 1; i < range.second; ++i) {
+      qreal distance2 = distance2ToSegment(polyline.at(i), a, b);
+      if (distance2 > maxDistance2) {
+        maxDistance2 = distance2;
+        farthest = i;
+      }
+    }
+    if ((farthest >= 0) && (maxDistance2 > tolerance2)) {
+      keep[farthest] = true;
+      stack.append(qMakePair(range.first, farthest));
+      stack.append(qMakePair(farthest, range.second));
+    }
+  }
+
+  QPolygonF result;
+  for (int i = 0; i < count; ++i) {
+    if (keep.at(i)) result.append(polyline.at(i));
+  }
+  return result;
+}
+
+/*******************************************************************************
+ *  Operator Overloadings
+ ******************************************************************************/
+
+LevelOfDetailPath& LevelOfDetailPath::operator=(
+    const LevelOfDetailPath& rhs) noexcept {
+  mPath = rhs.mPath;
+  mBoundingRect = rhs.mBoundingRect;
+  mSimplifiedPaths = rhs.mSimplifiedPaths;
+  return *this;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+qreal LevelOfDetailPath::distance2ToSegment(const QPointF& p, const QPointF& a,
+                                            const QPointF& b) noexcept {
+  QPointF ab = b - a;
+  QPointF ap = p - a;
+  qreal length2 = QPointF::dotProduct(ab, ab);
+  if (length2 > 0) {
+    qreal t = qBound(qreal(0), QPointF::dotProduct(ap, ab) / length2, qreal(1));
+    ap -= ab * t;
+  }
+  return QPointF::dotProduct(ap, ap);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
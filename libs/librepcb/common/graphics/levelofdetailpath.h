@@ -0,0 +1,146 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LEVELOFDETAILPATH_H
+#define LIBREPCB_LEVELOFDETAILPATH_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class LevelOfDetailPath
+ ******************************************************************************/
+
+/**
+ * @brief A QPainterPath with simplified variants for drawing when zoomed out
+ *
+ * When a graphics view is zoomed out, paths with many vertices (e.g. plane
+ * fragments or approximated arcs) are drawn with much more details than the
+ * screen is able to show. This class provides simplified variants of the
+ * path where all vertices closer than a fraction of a device pixel to the
+ * original outline are removed. Paths which are smaller than a device pixel
+ * are drawn as their bounding rect.
+ *
+ * The simplified paths are cached per zoom band (powers of two of the level
+ * of detail), so they are calculated only once when zooming in or out. The
+ * cache is cleared when a new path is set with #setPath().
+ */
+class LevelOfDetailPath final {
+public:
+  // Constructors / Destructor
+  LevelOfDetailPath() noexcept;
+  LevelOfDetailPath(const LevelOfDetailPath& other) noexcept;
+  explicit LevelOfDetailPath(const QPainterPath& path) noexcept;
+  ~LevelOfDetailPath() noexcept;
+
+  // Getters
+  const QPainterPath& getPath() const noexcept { return mPath; }
+  const QRectF& getBoundingRect() const noexcept { return mBoundingRect; }
+
+  /**
+   * @brief Check if the path is smaller than a device pixel
+   *
+   * @param lod   The level of detail (device pixels per scene pixel)
+   *
+   * @return Whether both width and height of the path are below one pixel
+   */
+  bool isTiny(qreal lod) const noexcept;
+
+  /**
+   * @brief Get the path to be drawn at a specific level of detail
+   *
+   * @param lod   The level of detail (device pixels per scene pixel)
+   *
+   * @return The simplified path, or the original path if the level of detail
+   *         is high enough to show all details
+   */
+  QPainterPath getSimplifiedPath(qreal lod) const noexcept;
+
+  // Setters
+  void setPath(const QPainterPath& path) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Draw the path with the current pen and brush of a painter
+   *
+   * @param painter   The painter to draw on
+   * @param lod       The level of detail, see #getLevelOfDetail()
+   */
+  void draw(QPainter& painter, qreal lod) const noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Get the level of detail to be used for painting a graphics item
+   *
+   * @param painter   The painter passed to QGraphicsItem::paint()
+   * @param option    The style option passed to QGraphicsItem::paint()
+   *
+   * @return The level of detail, or infinity if the painter device is not
+   *         the screen (printed and exported documents, e.g. PDF, SVG or
+   *         images, are never simplified)
+   */
+  static qreal getLevelOfDetail(const QPainter& painter,
+                                const QStyleOptionGraphicsItem& option) noexcept;
+
+  /**
+   * @brief Simplify a polyline with the Douglas-Peucker algorithm
+   *
+   * @param polyline    The polyline to simplify
+   * @param tolerance   The maximum allowed distance of removed vertices
+   *
+   * @return The polyline with a subset of the vertices (the first and last
+   *         vertex are always kept)
+   */
+  static QPolygonF simplifyPolyline(const QPolygonF& polyline,
+                                    qreal tolerance) noexcept;
+
+  // Operator Overloadings
+  LevelOfDetailPath& operator=(const LevelOfDetailPath& rhs) noexcept;
+
+private:  // Methods
+  static qreal distance2ToSegment(const QPointF& p, const QPointF& a,
+                                  const QPointF& b) noexcept;
+
+private:  // Data
+  QPainterPath mPath;
+  QRectF mBoundingRect;
+  mutable QHash<int, QPainterPath> mSimplifiedPaths;  ///< Key: Zoom band
+
+  static const qreal sMaxSimplifiedLevelOfDetail;
+  static const qreal sTinySizePx;
+  static const qreal sTolerancePx;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LEVELOFDETAILPATH_H
@@ -189,6 +189,8 @@ void PrimitiveCircleGraphicsItem::updateBoundingRectAndShape() noexcept {
   QPainterPath p;
   p.addEllipse(mCircleRect);
   mShape = Toolbox::shapeFromPath(p, mPen, mBrush, UnsignedLength(200000));
+  // the shape has a minimum width, so it might exceed the circle
+  mBoundingRect = mBoundingRect.united(mShape.boundingRect());
   update();
 }
 
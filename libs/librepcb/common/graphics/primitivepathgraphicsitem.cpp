@@ -71,7 +71,7 @@ void PrimitivePathGraphicsItem::setRotation(const Angle& rot) noexcept {
 }
 
 void PrimitivePathGraphicsItem::setPath(const QPainterPath& path) noexcept {
-  mPainterPath = path;
+  mPainterPath.setPath(path);
   updateBoundingRectAndShape();
 }
 
@@ -127,6 +127,7 @@ void PrimitivePathGraphicsItem::paint(QPainter* painter,
   const bool isSelected = option->state.testFlag(QStyle::State_Selected);
   const bool deviceIsPrinter =
       (dynamic_cast<QPrinter*>(painter->device()) != nullptr);
+  const qreal lod = LevelOfDetailPath::getLevelOfDetail(*painter, *option);
 
   QPen pen = isSelected ? mPenHighlighted : mPen;
   QBrush brush = isSelected ? mBrushHighlighted : mBrush;
@@ -140,7 +141,7 @@ void PrimitivePathGraphicsItem::paint(QPainter* painter,
 
   painter->setPen(pen);
   painter->setBrush(brush);
-  painter->drawPath(mPainterPath);
+  mPainterPath.draw(*painter, lod);
 }
 
 /*******************************************************************************
@@ -199,9 +200,9 @@ void PrimitivePathGraphicsItem::updateColors() noexcept {
 void PrimitivePathGraphicsItem::updateBoundingRectAndShape() noexcept {
   prepareGeometryChange();
   if (mShapeMode == ShapeMode::FILLED_OUTLINE) {
-    mShape = mPainterPath;
+    mShape = mPainterPath.getPath();
   } else {
-    mShape = Toolbox::shapeFromPath(mPainterPath, mPen, mBrush,
+    mShape = Toolbox::shapeFromPath(mPainterPath.getPath(), mPen, mBrush,
                                     UnsignedLength(200000));
   }
   mBoundingRect = mShape.controlPointRect();
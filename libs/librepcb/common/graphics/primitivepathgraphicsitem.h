@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../graphics/graphicslayer.h"
+#include "../graphics/levelofdetailpath.h"
 #include "../units/all_length_units.h"
 
 #include <QtCore>
@@ -93,7 +94,7 @@ protected:  // Data
   QPen mPenHighlighted;
   QBrush mBrush;
   QBrush mBrushHighlighted;
-  QPainterPath mPainterPath;
+  LevelOfDetailPath mPainterPath;
   QRectF mBoundingRect;
   QPainterPath mShape;
 
@@ -71,6 +71,13 @@ StrokeTextGraphicsItem::~StrokeTextGraphicsItem() noexcept {
  *  Inherited from QGraphicsItem
  ******************************************************************************/
 
+QRectF StrokeTextGraphicsItem::boundingRect() const noexcept {
+  // must contain the whole shape, since items are looked up by their bounding
+  // rect (e.g. empty texts can only be grabbed at their origin cross)
+  return PrimitivePathGraphicsItem::boundingRect().united(
+      mOriginCrossGraphicsItem->boundingRect());
+}
+
 QPainterPath StrokeTextGraphicsItem::shape() const noexcept {
   return PrimitivePathGraphicsItem::shape() + mOriginCrossGraphicsItem->shape();
 }
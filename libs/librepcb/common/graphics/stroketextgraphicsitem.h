@@ -58,6 +58,7 @@ public:
   StrokeText& getText() noexcept { return mText; }
 
   // Inherited from QGraphicsItem
+  QRectF boundingRect() const noexcept override;
   QPainterPath shape() const noexcept override;
 
   // Operator Overloadings
@@ -92,6 +92,7 @@ SQLiteDatabase::SQLiteDatabase(const FilePath& filepath)
 }
 
 SQLiteDatabase::~SQLiteDatabase() noexcept {
+  mQueryCache.clear();  // queries must be released before closing
   mDb.close();
 }
 
@@ -158,6 +159,14 @@ QSqlQuery SQLiteDatabase::prepareQuery(const QString& query) const {
   return q;
 }
 
+QSqlQuery& SQLiteDatabase::prepareCachedQuery(const QString& query) {
+  auto it = mQueryCache.find(query);
+  if (it == mQueryCache.end()) {
+    it = mQueryCache.insert(query, prepareQuery(query));  // can throw
+  }
+  return it.value();
+}
+
 int SQLiteDatabase::count(QSqlQuery& query) {
   exec(query);  // can throw
 
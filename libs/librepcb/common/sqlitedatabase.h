@@ -74,6 +74,24 @@ public:
 
   // General Methods
   QSqlQuery prepareQuery(const QString& query) const;
+
+  /**
+   * @brief Get a prepared query from the statement cache
+   *
+   * The query is prepared only the first time it is requested, afterwards the
+   * same object is returned again. This avoids parsing the same SQL statement
+   * again and again when executing it many times (e.g. inserts in a loop).
+   *
+   * @note Bind all values before executing the returned query since values
+   *       from the previous execution are still bound. The reference is valid
+   *       until this object is destroyed.
+   *
+   * @param query   The SQL statement (used as the cache key)
+   *
+   * @return The prepared query
+   */
+  QSqlQuery& prepareCachedQuery(const QString& query);
+
   int count(QSqlQuery& query);
   int insert(QSqlQuery& query);
   void exec(QSqlQuery& query);
@@ -105,6 +123,7 @@ private:  // Methods
 
 private:  // Data
   QSqlDatabase mDb;
+  QHash<QString, QSqlQuery> mQueryCache;
   // int mNestedTransactionCount;
 };
 
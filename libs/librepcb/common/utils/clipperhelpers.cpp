@@ -137,6 +137,32 @@ ClipperLib::Paths ClipperHelpers::flattenTree(
   return paths;
 }
 
+ClipperLib::IntRect ClipperHelpers::getBounds(
+    const ClipperLib::Paths& paths) noexcept {
+  ClipperLib::IntRect rect = {0, 0, 0, 0};
+  bool first = true;
+  for (const ClipperLib::Path& path : paths) {
+    for (const ClipperLib::IntPoint& p : path) {
+      if (first) {
+        rect = {p.X, p.Y, p.X, p.Y};
+        first = false;
+      } else {
+        rect.left = qMin(rect.left, p.X);
+        rect.top = qMin(rect.top, p.Y);
+        rect.right = qMax(rect.right, p.X);
+        rect.bottom = qMax(rect.bottom, p.Y);
+      }
+    }
+  }
+  return rect;
+}
+
+bool ClipperHelpers::boundsIntersect(const ClipperLib::IntRect& r1,
+                                     const ClipperLib::IntRect& r2) noexcept {
+  return (r1.left <= r2.right) && (r2.left <= r1.right) &&
+      (r1.top <= r2.bottom) && (r2.top <= r1.bottom);
+}
+
 /*******************************************************************************
  *  Conversion Methods
  ******************************************************************************/
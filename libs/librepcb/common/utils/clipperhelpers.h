@@ -62,6 +62,9 @@ public:
   static void offset(ClipperLib::Paths& paths, const Length& offset,
                      const PositiveLength& maxArcTolerance);
   static ClipperLib::Paths flattenTree(const ClipperLib::PolyNode& node);
+  static ClipperLib::IntRect getBounds(const ClipperLib::Paths& paths) noexcept;
+  static bool boundsIntersect(const ClipperLib::IntRect& r1,
+                              const ClipperLib::IntRect& r2) noexcept;
 
   // Type Conversions
   static QVector<Path> convert(const ClipperLib::Paths& paths) noexcept;
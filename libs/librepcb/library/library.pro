@@ -61,6 +61,7 @@ SOURCES += \
     librarybaseelementcheck.cpp \
     libraryelement.cpp \
     libraryelementcheck.cpp \
+    libraryelementmetadata.cpp \
     msg/libraryelementcheckmessage.cpp \
     msg/msgmissingauthor.cpp \
     msg/msgmissingcategories.cpp \
@@ -138,6 +139,7 @@ HEADERS += \
     librarybaseelementcheck.h \
     libraryelement.h \
     libraryelementcheck.h \
+    libraryelementmetadata.h \
     msg/libraryelementcheckmessage.h \
     msg/msgmissingauthor.h \
     msg/msgmissingcategories.h \
@@ -0,0 +1,168 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "libraryelementmetadata.h"
+
+#include "library.h"
+
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/versionfile.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryElementMetadata::LibraryElementMetadata(
+    const TransactionalDirectory& directory, bool dirnameMustBeUuid,
+    const QString& shortElementName, const QString& longElementName)
+  : mUuid(Uuid::createRandom()),  // just for initialization, will be
+                                  // overwritten
+    mVersion(Version::fromString(
+        "0.1")),  // just for initialization, will be overwritten
+    mIsDeprecated(false),
+    mNames(ElementName(
+        "unknown")),  // just for initialization, will be overwritten
+    mDescriptions(""),
+    mKeywords("") {
+  // Note: Keep these checks in sync with the constructor of
+  // librepcb::library::LibraryBaseElement!
+
+  // check if the directory is a library element
+  QString versionFileName = ".librepcb-" % shortElementName;
+  if (!directory.fileExists(versionFileName)) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("Directory is not a library element of type %1: \"%2\"")
+            .arg(longElementName, directory.getAbsPath().toNative()));
+  }
+
+  // check directory name
+  QString dirUuidStr = directory.getAbsPath().getFilename();
+  if (dirnameMustBeUuid && (!Uuid::isValid(dirUuidStr))) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Directory name is not a valid UUID: \"%1\"")
+                           .arg(directory.getAbsPath().toNative()));
+  }
+
+  // read version number from version file
+  VersionFile versionFile =
+      VersionFile::fromByteArray(directory.read(versionFileName));
+  Version fileFormat = versionFile.getVersion();
+  if (fileFormat > qApp->getAppVersion()) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(
+            tr("The library element %1 was created with a newer application "
+               "version. You need at least LibrePCB version %2 to open it."))
+            .arg(directory.getAbsPath().toNative())
+            .arg(fileFormat.toPrettyStr(3)));
+  }
+
+  // parse only the metadata nodes of the main file
+  QString sexprFileName = longElementName % ".lp";
+  FilePath sexprFilePath = directory.getAbsPath(sexprFileName);
+  static const QSet<QString> metadataNodes = {
+      "name",     "description", "keywords", "author",    "version",
+      "created",  "deprecated",  "category", "parent",    "component",
+      "package",
+  };
+  SExpression root = SExpression::parseFiltered(
+      directory.read(sexprFileName), sexprFilePath, metadataNodes);
+
+  // read attributes
+  mUuid = deserialize<Uuid>(root.getChild("@0"), fileFormat);
+  mVersion = deserialize<Version>(root.getChild("version/@0"), fileFormat);
+  mAuthor = root.getChild("author/@0").getValue();
+  mCreated = deserialize<QDateTime>(root.getChild("created/@0"), fileFormat);
+  mIsDeprecated = deserialize<bool>(root.getChild("deprecated/@0"), fileFormat);
+  mNames = LocalizedNameMap(root, fileFormat);
+  mDescriptions = LocalizedDescriptionMap(root, fileFormat);
+  mKeywords = LocalizedKeywordsMap(root, fileFormat);
+
+  // read type specific attributes
+  foreach (const SExpression& node, root.getChildren("category")) {
+    mCategories.insert(deserialize<Uuid>(node.getChild("@0"), fileFormat));
+  }
+  if (const SExpression* node = root.tryGetChild("parent/@0")) {
+    mParentUuid = deserialize<tl::optional<Uuid>>(*node, fileFormat);
+  }
+  if (const SExpression* node = root.tryGetChild("component/@0")) {
+    mComponentUuid = deserialize<Uuid>(*node, fileFormat);
+  }
+  if (const SExpression* node = root.tryGetChild("package/@0")) {
+    mPackageUuid = deserialize<Uuid>(*node, fileFormat);
+  }
+
+  // check if the UUID equals to the directory basename
+  if (dirnameMustBeUuid && (mUuid.toStr() != dirUuidStr)) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(
+            tr("UUID mismatch between element directory and main file: \"%1\""))
+            .arg(sexprFilePath.toNative()));
+  }
+}
+
+LibraryElementMetadata::~LibraryElementMetadata() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QStringList LibraryElementMetadata::getAllAvailableLocales() const noexcept {
+  QStringList list;
+  list.append(mNames.keys());
+  list.append(mDescriptions.keys());
+  list.append(mKeywords.keys());
+  list.removeDuplicates();
+  list.sort(Qt::CaseSensitive);
+  return list;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+template <>
+LibraryElementMetadata LibraryElementMetadata::open<Library>(
+    const TransactionalDirectory& directory) {
+  // the directory name of libraries is not a UUID
+  return LibraryElementMetadata(directory, false,
+                                Library::getShortElementName(),
+                                Library::getLongElementName());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,144 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+#define LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/serializablekeyvaluemap.h>
+#include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/uuid.h>
+#include <librepcb/common/version.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+class Library;
+
+/*******************************************************************************
+ *  Class LibraryElementMetadata
+ ******************************************************************************/
+
+/**
+ * @brief The metadata of a library element, loaded without the element itself
+ *
+ * Opening a library element (e.g. a ::librepcb::library::Package) parses and
+ * deserializes its whole main file. This class only parses the small nodes
+ * containing the metadata (UUID, version, translations, categories etc.) and
+ * skips all other nodes like footprints, so it is much faster if only the
+ * metadata is needed (e.g. to index libraries).
+ *
+ * Only the directory (e.g. the file format version) and the parsed metadata
+ * nodes are validated. Errors in the skipped nodes are not detected, so a
+ * directory which can be loaded with this class might still fail to be
+ * opened as library element.
+ *
+ * @note In contrast to library elements, objects of this class are not
+ *       QObjects and can safely be created in any thread.
+ */
+class LibraryElementMetadata final {
+  Q_DECLARE_TR_FUNCTIONS(LibraryElementMetadata)
+
+public:
+  // Constructors / Destructor
+  LibraryElementMetadata() = delete;
+  LibraryElementMetadata(const LibraryElementMetadata& other) = default;
+  LibraryElementMetadata(const TransactionalDirectory& directory,
+                         bool dirnameMustBeUuid,
+                         const QString& shortElementName,
+                         const QString& longElementName);
+  ~LibraryElementMetadata() noexcept;
+
+  // Getters
+  const Uuid& getUuid() const noexcept { return mUuid; }
+  const Version& getVersion() const noexcept { return mVersion; }
+  const QString& getAuthor() const noexcept { return mAuthor; }
+  const QDateTime& getCreated() const noexcept { return mCreated; }
+  bool isDeprecated() const noexcept { return mIsDeprecated; }
+  const LocalizedNameMap& getNames() const noexcept { return mNames; }
+  const LocalizedDescriptionMap& getDescriptions() const noexcept {
+    return mDescriptions;
+  }
+  const LocalizedKeywordsMap& getKeywords() const noexcept { return mKeywords; }
+  QStringList getAllAvailableLocales() const noexcept;
+
+  /// Categories of library elements (empty for all other elements)
+  const QSet<Uuid>& getCategories() const noexcept { return mCategories; }
+
+  /// Parent of categories (tl::nullopt for all other elements)
+  const tl::optional<Uuid>& getParentUuid() const noexcept {
+    return mParentUuid;
+  }
+
+  /// Component of devices (tl::nullopt for all other elements)
+  const tl::optional<Uuid>& getComponentUuid() const noexcept {
+    return mComponentUuid;
+  }
+
+  /// Package of devices (tl::nullopt for all other elements)
+  const tl::optional<Uuid>& getPackageUuid() const noexcept {
+    return mPackageUuid;
+  }
+
+  // Operator Overloadings
+  LibraryElementMetadata& operator=(const LibraryElementMetadata& rhs) =
+      default;
+
+  // Static Methods
+  template <typename ElementType>
+  static LibraryElementMetadata open(const TransactionalDirectory& directory) {
+    return LibraryElementMetadata(directory, true,
+                                  ElementType::getShortElementName(),
+                                  ElementType::getLongElementName());
+  }
+
+private:  // Data
+  Uuid mUuid;
+  Version mVersion;
+  QString mAuthor;
+  QDateTime mCreated;
+  bool mIsDeprecated;
+  LocalizedNameMap mNames;
+  LocalizedDescriptionMap mDescriptions;
+  LocalizedKeywordsMap mKeywords;
+  QSet<Uuid> mCategories;
+  tl::optional<Uuid> mParentUuid;
+  tl::optional<Uuid> mComponentUuid;
+  tl::optional<Uuid> mPackageUuid;
+};
+
+template <>
+LibraryElementMetadata LibraryElementMetadata::open<Library>(
+    const TransactionalDirectory& directory);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
@@ -30,6 +30,7 @@
 #include "boardairwiresbuilder.h"
 #include "boardfabricationoutputsettings.h"
 #include "boardlayerstack.h"
+#include "boardplanefragmentsbuilder.h"
 #include "boardselectionquery.h"
 #include "boardusersettings.h"
 #include "items/bi_airwire.h"
@@ -57,6 +58,7 @@
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/pkg/footprint.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -79,6 +81,8 @@ Board::Board(const Board& other,
     mProject(other.getProject()),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsDirty(true),
+    mAllPlanesInvalidated(true),
     mUuid(Uuid::createRandom()),
     mName(name),
     mDefaultFontFileName(other.mDefaultFontFileName) {
@@ -156,6 +160,8 @@ Board::Board(const Board& other,
             &Board::updateErcMessages);
     connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
             &Board::updateErcMessages);
+    connect(&mProject.getCircuit(), &Circuit::netSignalRemoved, this,
+            &Board::netSignalRemoved);
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
@@ -191,6 +197,8 @@ Board::Board(Project& project,
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsDirty(true),
+    mAllPlanesInvalidated(true),
     mUuid(Uuid::createRandom()),
     mName("New Board") {
   try {
@@ -340,6 +348,8 @@ Board::Board(Project& project,
             &Board::updateErcMessages);
     connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
             &Board::updateErcMessages);
+    connect(&mProject.getCircuit(), &Circuit::netSignalRemoved, this,
+            &Board::netSignalRemoved);
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
@@ -414,88 +424,80 @@ bool Board::isEmpty() const noexcept {
 
 QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
   QPointF scenePosPx = pos.toPxQPointF();
+  QList<BI_Base*> candidates;
+  foreach (BI_Base* item,
+           getIndexedItems(mGraphicsScene->items(
+               scenePosPx, Qt::IntersectsItemBoundingRect))) {
+    if (item->isSelectable() &&
+        item->getGrabAreaScenePx().contains(scenePosPx)) {
+      candidates.append(item);
+    }
+  }
+  auto appendItems = [&](QList<BI_Base*>& list, BI_Base::Type_t type) {
+    foreach (BI_Base* item, candidates) {
+      if (item->getType() == type) list.append(item);
+    }
+  };
   QList<BI_Base*>
       list;  // Note: The order of adding the items is very important (the
              // top most item must appear as the first item in the list)!
-  // vias
-  foreach (BI_Via* via, getViasAtScenePos(pos)) { list.append(via); }
-  // netpoints
-  foreach (BI_NetPoint* netpoint, getNetPointsAtScenePos(pos)) {
-    list.append(netpoint);
-  }
-  // netlines
-  foreach (BI_NetLine* netline, getNetLinesAtScenePos(pos)) {
-    list.append(netline);
-  }
-  // footprints & pads
-  foreach (BI_Device* device, mDeviceInstances) {
-    BI_Footprint& footprint = device->getFootprint();
-    if (footprint.isSelectable() &&
-        footprint.getGrabAreaScenePx().contains(scenePosPx)) {
-      if (footprint.getIsMirrored()) {
-        list.append(&footprint);
+  // vias, netpoints & netlines
+  appendItems(list, BI_Base::Type_t::Via);
+  appendItems(list, BI_Base::Type_t::NetPoint);
+  appendItems(list, BI_Base::Type_t::NetLine);
+  // footprints, pads & texts of footprints
+  foreach (BI_Base* item, candidates) {
+    if (item->getType() == BI_Base::Type_t::Footprint) {
+      if (item->getIsMirrored()) {
+        list.append(item);
       } else {
-        list.prepend(&footprint);
+        list.prepend(item);
       }
-    }
-    foreach (BI_FootprintPad* pad, footprint.getPads()) {
-      if (pad->isSelectable() &&
-          pad->getGrabAreaScenePx().contains(scenePosPx)) {
-        if (pad->getIsMirrored()) {
-          list.append(pad);
-        } else {
-          list.insert(1, pad);
-        }
+    } else if (item->getType() == BI_Base::Type_t::FootprintPad) {
+      if (item->getIsMirrored()) {
+        list.append(item);
+      } else {
+        list.insert(1, item);
       }
-    }
-    foreach (BI_StrokeText* text, device->getFootprint().getStrokeTexts()) {
-      if (text->isSelectable() &&
-          text->getGrabAreaScenePx().contains(scenePosPx)) {
-        if (GraphicsLayer::isTopLayer(*text->getText().getLayerName())) {
-          list.prepend(text);
-        } else {
-          list.append(text);
-        }
+    } else if ((item->getType() == BI_Base::Type_t::StrokeText) &&
+               static_cast<BI_StrokeText*>(item)->getFootprint()) {
+      BI_StrokeText* text = static_cast<BI_StrokeText*>(item);
+      if (GraphicsLayer::isTopLayer(*text->getText().getLayerName())) {
+        list.prepend(text);
+      } else {
+        list.append(text);
       }
     }
   }
-  // planes
-  foreach (BI_Plane* planes, mPlanes) {
-    if (planes->isSelectable() &&
-        planes->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(planes);
-    }
-  }
-  // polygons
-  foreach (BI_Polygon* polygon, mPolygons) {
-    if (polygon->isSelectable() &&
-        polygon->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(polygon);
-    }
-  }
+  // planes & polygons
+  appendItems(list, BI_Base::Type_t::Plane);
+  appendItems(list, BI_Base::Type_t::Polygon);
   // texts
-  foreach (BI_StrokeText* text, mStrokeTexts) {
-    if (text->isSelectable() &&
-        text->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(text);
+  foreach (BI_Base* item, candidates) {
+    if ((item->getType() == BI_Base::Type_t::StrokeText) &&
+        (!static_cast<BI_StrokeText*>(item)->getFootprint())) {
+      list.append(item);
     }
   }
   // holes
-  foreach (BI_Hole* hole, mHoles) {
-    if (hole->isSelectable() &&
-        hole->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(hole);
-    }
-  }
+  appendItems(list, BI_Base::Type_t::Hole);
   return list;
 }
 
 QList<BI_Via*> Board::getViasAtScenePos(
     const Point& pos, const QSet<const NetSignal*>& netsignals) const noexcept {
+  QPointF scenePosPx = pos.toPxQPointF();
   QList<BI_Via*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if (netsignals.isEmpty() || netsignals.contains(segment->getNetSignal())) {
-      segment->getViasAtScenePos(pos, list);
+  foreach (BI_Base* item,
+           getIndexedItems(mGraphicsScene->items(
+               scenePosPx, Qt::IntersectsItemBoundingRect))) {
+    if (item->getType() != BI_Base::Type_t::Via) continue;
+    BI_Via* via = static_cast<BI_Via*>(item);
+    if (via->isSelectable() &&
+        via->getGrabAreaScenePx().contains(scenePosPx) &&
+        (netsignals.isEmpty() ||
+         netsignals.contains(via->getNetSegment().getNetSignal()))) {
+      list.append(via);
     }
   }
   return list;
@@ -504,10 +506,19 @@ QList<BI_Via*> Board::getViasAtScenePos(
 QList<BI_NetPoint*> Board::getNetPointsAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const QSet<const NetSignal*>& netsignals) const noexcept {
+  QPointF scenePosPx = pos.toPxQPointF();
   QList<BI_NetPoint*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if (netsignals.isEmpty() || netsignals.contains(segment->getNetSignal())) {
-      segment->getNetPointsAtScenePos(pos, layer, list);
+  foreach (BI_Base* item,
+           getIndexedItems(mGraphicsScene->items(
+               scenePosPx, Qt::IntersectsItemBoundingRect))) {
+    if (item->getType() != BI_Base::Type_t::NetPoint) continue;
+    BI_NetPoint* netpoint = static_cast<BI_NetPoint*>(item);
+    if (netpoint->isSelectable() &&
+        netpoint->getGrabAreaScenePx().contains(scenePosPx) &&
+        ((!layer) || (netpoint->getLayerOfLines() == layer)) &&
+        (netsignals.isEmpty() ||
+         netsignals.contains(netpoint->getNetSegment().getNetSignal()))) {
+      list.append(netpoint);
     }
   }
   return list;
@@ -516,10 +527,19 @@ QList<BI_NetPoint*> Board::getNetPointsAtScenePos(
 QList<BI_NetLine*> Board::getNetLinesAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const QSet<const NetSignal*>& netsignals) const noexcept {
+  QPointF scenePosPx = pos.toPxQPointF();
   QList<BI_NetLine*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if (netsignals.isEmpty() || netsignals.contains(segment->getNetSignal())) {
-      segment->getNetLinesAtScenePos(pos, layer, list);
+  foreach (BI_Base* item,
+           getIndexedItems(mGraphicsScene->items(
+               scenePosPx, Qt::IntersectsItemBoundingRect))) {
+    if (item->getType() != BI_Base::Type_t::NetLine) continue;
+    BI_NetLine* netline = static_cast<BI_NetLine*>(item);
+    if (netline->isSelectable() &&
+        netline->getGrabAreaScenePx().contains(scenePosPx) &&
+        ((!layer) || (&netline->getLayer() == layer)) &&
+        (netsignals.isEmpty() ||
+         netsignals.contains(netline->getNetSegment().getNetSignal()))) {
+      list.append(netline);
     }
   }
   return list;
@@ -528,16 +548,18 @@ QList<BI_NetLine*> Board::getNetLinesAtScenePos(
 QList<BI_FootprintPad*> Board::getPadsAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const QSet<const NetSignal*>& netsignals) const noexcept {
+  QPointF scenePosPx = pos.toPxQPointF();
   QList<BI_FootprintPad*> list;
-  foreach (BI_Device* device, mDeviceInstances) {
-    foreach (BI_FootprintPad* pad, device->getFootprint().getPads()) {
-      if (pad->isSelectable() &&
-          pad->getGrabAreaScenePx().contains(pos.toPxQPointF()) &&
-          ((!layer) || (pad->isOnLayer(layer->getName()))) &&
-          (netsignals.isEmpty() ||
-           netsignals.contains(pad->getCompSigInstNetSignal()))) {
-        list.append(pad);
-      }
+  foreach (BI_Base* item,
+           getIndexedItems(mGraphicsScene->items(
+               scenePosPx, Qt::IntersectsItemBoundingRect))) {
+    if (item->getType() != BI_Base::Type_t::FootprintPad) continue;
+    BI_FootprintPad* pad = static_cast<BI_FootprintPad*>(item);
+    if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(scenePosPx) &&
+        ((!layer) || (pad->isOnLayer(layer->getName()))) &&
+        (netsignals.isEmpty() ||
+         netsignals.contains(pad->getCompSigInstNetSignal()))) {
+      list.append(pad);
     }
   }
   return list;
@@ -622,6 +644,7 @@ QList<BI_Base*> Board::getAllItems() const noexcept {
 
 void Board::setGridProperties(const GridProperties& grid) noexcept {
   *mGridProperties = grid;
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -648,6 +671,8 @@ void Board::addDeviceInstance(BI_Device& instance) {
   // add to board
   instance.addToBoard();  // can throw
   mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
+  mIsDirty = true;
+  invalidatePlanes(instance);
   updateErcMessages();
   emit deviceAdded(instance);
 }
@@ -658,8 +683,10 @@ void Board::removeDeviceInstance(BI_Device& instance) {
     throw LogicError(__FILE__, __LINE__);
   }
   // remove from board
+  invalidatePlanes(instance);
   instance.removeFromBoard();  // can throw
   mDeviceInstances.remove(instance.getComponentInstanceUuid());
+  mIsDirty = true;
   updateErcMessages();
   emit deviceRemoved(instance);
 }
@@ -690,6 +717,8 @@ void Board::addNetSegment(BI_NetSegment& netsegment) {
   // add to board
   netsegment.addToBoard();  // can throw
   mNetSegments.append(&netsegment);
+  mIsDirty = true;
+  invalidatePlanes(netsegment);
 }
 
 void Board::removeNetSegment(BI_NetSegment& netsegment) {
@@ -697,8 +726,10 @@ void Board::removeNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   // remove from board
+  invalidatePlanes(netsegment);
   netsegment.removeFromBoard();  // can throw
   mNetSegments.removeOne(&netsegment);
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -712,23 +743,150 @@ void Board::addPlane(BI_Plane& plane) {
   }
   plane.addToBoard();  // can throw
   mPlanes.append(&plane);
+  mIsDirty = true;
+  emit copperModified(&plane.getNetSignal());
+  invalidatePlanes(plane.getOutline().toQPainterPathPx().boundingRect());
 }
 
 void Board::removePlane(BI_Plane& plane) {
   if ((!mIsAddedToProject) || (!mPlanes.contains(&plane))) {
     throw LogicError(__FILE__, __LINE__);
   }
+  invalidatePlanes(plane.getOutline().toQPainterPathPx().boundingRect());
   plane.removeFromBoard();  // can throw
   mPlanes.removeOne(&plane);
+  mIsDirty = true;
+  emit copperModified(&plane.getNetSignal());
 }
 
 void Board::rebuildAllPlanes() noexcept {
+  // build all planes concurrently, then apply all results at once
+  BoardPlaneFragmentsBuilder::PlaneFragments fragments =
+      BoardPlaneFragmentsBuilder::buildAllFragments(mPlanes);
+  foreach (BI_Plane* plane, mPlanes) {
+    plane->setFragments(fragments.value(plane));
+  }
+  mInvalidatedPlaneAreasPx.clear();
+  mAllPlanesInvalidated = false;
+}
+
+void Board::rebuildInvalidatedPlanes() noexcept {
+  if (mAllPlanesInvalidated) {
+    rebuildAllPlanes();
+    return;
+  }
+
+  // Determine the affected planes, with the highest priority first. A rebuilt
+  // plane may change planes with lower priority on the same layer anywhere
+  // within its outline, so its area is treated as invalidated as well.
   QList<BI_Plane*> planes = mPlanes;
   std::sort(planes.begin(), planes.end(),
             [](const BI_Plane* p1, const BI_Plane* p2) {
               return !(*p1 < *p2);
-            });  // sort by priority (highest priority first)
-  foreach (BI_Plane* plane, planes) { plane->rebuild(); }
+            });
+  QList<QRectF> areas = mInvalidatedPlaneAreasPx;
+  QList<BI_Plane*> affectedPlanes;
+  foreach (BI_Plane* plane, planes) {
+    // objects within clearance and minimum width affect the plane too
+    qreal margin = (*plane->getMinClearance() + *plane->getMinWidth()).toPx();
+    QRectF planeArea = plane->getOutline().toQPainterPathPx().boundingRect();
+    planeArea.adjust(-margin, -margin, margin, margin);
+    foreach (const QRectF& area, areas) {
+      if (area.intersects(planeArea)) {
+        affectedPlanes.append(plane);
+        areas.append(planeArea);
+        break;
+      }
+    }
+  }
+
+  // build affected planes concurrently, then apply all results at once
+  BoardPlaneFragmentsBuilder::PlaneFragments fragments =
+      BoardPlaneFragmentsBuilder::buildAllFragments(affectedPlanes);
+  foreach (BI_Plane* plane, affectedPlanes) {
+    plane->setFragments(fragments.value(plane));
+  }
+  mInvalidatedPlaneAreasPx.clear();
+}
+
+void Board::invalidatePlanes(const QRectF& areaPx) noexcept {
+  if (areaPx.isNull()) return;
+  // merge overlapping areas to keep the list short (e.g. while dragging)
+  for (QRectF& area : mInvalidatedPlaneAreasPx) {
+    if (area.intersects(areaPx)) {
+      area = area.united(areaPx);
+      return;
+    }
+  }
+  mInvalidatedPlaneAreasPx.append(areaPx);
+}
+
+void Board::invalidatePlanes(const BI_Device& device) noexcept {
+  emit deviceModified(device);
+  emit copperModified(nullptr);  // footprint polygons and texts
+  const BI_Footprint& footprint = device.getFootprint();
+  foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+    emit copperModified(pad->getCompSigInstNetSignal());
+    invalidatePlanes(pad->getSceneOutline().toQPainterPathPx().boundingRect());
+    foreach (const BI_NetLine* netline, pad->getNetLines()) {
+      invalidatePlanes(*netline);
+    }
+  }
+  for (const Hole& hole : device.getLibFootprint().getHoles()) {
+    Path path = Path::circle(hole.getDiameter())
+                    .translated(footprint.mapToScene(hole.getPosition()));
+    invalidatePlanes(path.toQPainterPathPx().boundingRect());
+  }
+  for (const Polygon& polygon : device.getLibFootprint().getPolygons()) {
+    Path path = polygon.getPath();
+    path.rotate(footprint.getRotation());
+    if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
+    path.translate(footprint.getPosition());
+    invalidatePlanes(path.toQPainterPathPx().boundingRect());
+  }
+}
+
+void Board::invalidatePlanes(const BI_NetSegment& netsegment) noexcept {
+  emit copperModified(netsegment.getNetSignal());
+  foreach (const BI_Via* via, netsegment.getVias()) { invalidatePlanes(*via); }
+  foreach (const BI_NetLine* netline, netsegment.getNetLines()) {
+    invalidatePlanes(*netline);
+  }
+}
+
+void Board::invalidatePlanes(const BI_Via& via) noexcept {
+  emit copperModified(via.getNetSegment().getNetSignal());
+  invalidatePlanes(
+      via.getVia().getSceneOutline().toQPainterPathPx().boundingRect());
+  foreach (const BI_NetLine* netline, via.getNetLines()) {
+    invalidatePlanes(*netline);
+  }
+}
+
+void Board::invalidatePlanes(const BI_NetPoint& netpoint) noexcept {
+  foreach (const BI_NetLine* netline, netpoint.getNetLines()) {
+    invalidatePlanes(*netline);
+  }
+}
+
+void Board::invalidatePlanes(const BI_NetLine& netline) noexcept {
+  emit copperModified(netline.getNetSegment().getNetSignal());
+  invalidatePlanes(netline.getSceneOutline().toQPainterPathPx().boundingRect());
+}
+
+/*******************************************************************************
+ *  Spatial Index Methods
+ ******************************************************************************/
+
+void Board::registerGraphicsItem(const QGraphicsItem& graphicsItem,
+                                 BI_Base& item) noexcept {
+  Q_ASSERT(!mItemsByGraphicsItem.contains(&graphicsItem));
+  mItemsByGraphicsItem.insert(&graphicsItem, &item);
+}
+
+void Board::unregisterGraphicsItem(const QGraphicsItem& graphicsItem) noexcept {
+  Q_ASSERT(mItemsByGraphicsItem.contains(&graphicsItem));
+  mItemsByGraphicsItem.remove(&graphicsItem);
 }
 
 /*******************************************************************************
@@ -742,14 +900,22 @@ void Board::addPolygon(BI_Polygon& polygon) {
   }
   polygon.addToBoard();  // can throw
   mPolygons.append(&polygon);
+  mIsDirty = true;
+  emit copperModified(nullptr);
+  invalidatePlanes(
+      polygon.getPolygon().getPath().toQPainterPathPx().boundingRect());
 }
 
 void Board::removePolygon(BI_Polygon& polygon) {
   if ((!mIsAddedToProject) || (!mPolygons.contains(&polygon))) {
     throw LogicError(__FILE__, __LINE__);
   }
+  invalidatePlanes(
+      polygon.getPolygon().getPath().toQPainterPathPx().boundingRect());
   polygon.removeFromBoard();  // can throw
   mPolygons.removeOne(&polygon);
+  mIsDirty = true;
+  emit copperModified(nullptr);
 }
 
 /*******************************************************************************
@@ -763,6 +929,8 @@ void Board::addStrokeText(BI_StrokeText& text) {
   }
   text.addToBoard();  // can throw
   mStrokeTexts.append(&text);
+  mIsDirty = true;
+  emit copperModified(nullptr);
 }
 
 void Board::removeStrokeText(BI_StrokeText& text) {
@@ -771,6 +939,8 @@ void Board::removeStrokeText(BI_StrokeText& text) {
   }
   text.removeFromBoard();  // can throw
   mStrokeTexts.removeOne(&text);
+  mIsDirty = true;
+  emit copperModified(nullptr);
 }
 
 /*******************************************************************************
@@ -784,14 +954,24 @@ void Board::addHole(BI_Hole& hole) {
   }
   hole.addToBoard();  // can throw
   mHoles.append(&hole);
+  mIsDirty = true;
+  invalidatePlanes(Path::circle(hole.getHole().getDiameter())
+                       .translated(hole.getHole().getPosition())
+                       .toQPainterPathPx()
+                       .boundingRect());
 }
 
 void Board::removeHole(BI_Hole& hole) {
   if ((!mIsAddedToProject) || (!mHoles.contains(&hole))) {
     throw LogicError(__FILE__, __LINE__);
   }
+  invalidatePlanes(Path::circle(hole.getHole().getDiameter())
+                       .translated(hole.getHole().getPosition())
+                       .toQPainterPathPx()
+                       .boundingRect());
   hole.removeFromBoard();  // can throw
   mHoles.removeOne(&hole);
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -804,25 +984,46 @@ void Board::triggerAirWiresRebuild() noexcept {
   }
 
   try {
+    // Collect the data of all nets in the main thread, then calculate the
+    // airwires of all nets in parallel since the nets are independent.
+    typedef QVector<QPair<Point, Point>> AirWires;
+    QList<NetSignal*> netsignals;
+    QList<QFuture<AirWires>> futures;
+    foreach (NetSignal* netsignal, mScheduledNetSignalsForAirWireRebuild) {
+      std::shared_ptr<BoardAirWiresBuilder> previous =
+          mAirWiresBuilders.take(netsignal);
+      if (netsignal && netsignal->isAddedToCircuit()) {
+        std::shared_ptr<BoardAirWiresBuilder> builder =
+            std::make_shared<BoardAirWiresBuilder>(*this, *netsignal);
+        mAirWiresBuilders.insert(netsignal, builder);
+        netsignals.append(netsignal);
+        futures.append(QtConcurrent::run([builder, previous]() -> AirWires {
+          try {
+            return builder->buildAirWires(previous.get());
+          } catch (const std::exception& e) {
+            qCritical() << "Failed to build airwires:" << e.what();
+            return AirWires();
+          }
+        }));
+      }
+    }
+
+    // remove old airwires
     foreach (NetSignal* netsignal, mScheduledNetSignalsForAirWireRebuild) {
-      // remove old airwires
       while (BI_AirWire* airWire = mAirWires.take(netsignal)) {
         airWire->removeFromBoard();  // can throw
         delete airWire;
       }
+    }
 
-      if (netsignal && netsignal->isAddedToCircuit()) {
-        // calculate new airwires
-        BoardAirWiresBuilder builder(*this, *netsignal);
-        QVector<QPair<Point, Point>> airwires = builder.buildAirWires();
-
-        // add new airwires
-        foreach (const auto& points, airwires) {
-          QScopedPointer<BI_AirWire> airWire(
-              new BI_AirWire(*this, *netsignal, points.first, points.second));
-          airWire->addToBoard();  // can throw
-          mAirWires.insertMulti(netsignal, airWire.take());
-        }
+    // add new airwires (graphics items must be created in the main thread)
+    for (int i = 0; i < netsignals.count(); ++i) {
+      NetSignal* netsignal = netsignals.at(i);
+      foreach (const auto& points, futures[i].result()) {
+        QScopedPointer<BI_AirWire> airWire(
+            new BI_AirWire(*this, *netsignal, points.first, points.second));
+        airWire->addToBoard();  // can throw
+        mAirWires.insertMulti(netsignal, airWire.take());
       }
     }
     mScheduledNetSignalsForAirWireRebuild.clear();
@@ -833,6 +1034,7 @@ void Board::triggerAirWiresRebuild() noexcept {
 }
 
 void Board::forceAirWiresRebuild() noexcept {
+  mAirWiresBuilders.clear();  // rebuild from scratch
   mScheduledNetSignalsForAirWireRebuild.unite(
       Toolbox::toSet(mProject.getCircuit().getNetSignals().values()));
   mScheduledNetSignalsForAirWireRebuild.unite(Toolbox::toSet(mAirWires.keys()));
@@ -855,6 +1057,7 @@ void Board::addToProject() {
     sgl.add([item]() { item->removeFromBoard(); });
   }
   mIsAddedToProject = true;
+  mIsDirty = true;  // the board directory might have been removed in between
   forceAirWiresRebuild();
   updateErcMessages();
   sgl.dismiss();
@@ -872,16 +1075,21 @@ void Board::removeFromProject() {
     sgl.add([item]() { item->addToBoard(); });
   }
   mIsAddedToProject = false;
+  mIsDirty = true;
+  mAirWiresBuilders.clear();  // rebuilt from scratch when added again
   updateErcMessages();
   sgl.dismiss();
 }
 
 void Board::save() {
   if (mIsAddedToProject) {
-    // save board file
-    SExpression brdDoc(serializeToDomElement("librepcb_board"));  // can throw
-    mDirectory->write(getFilePath().getFilename(),
-                      brdDoc.toByteArray());  // can throw
+    // save board file, but only if it was modified since the last save
+    if (mIsDirty) {
+      SExpression brdDoc(serializeToDomElement("librepcb_board"));  // can throw
+      mDirectory->write(getFilePath().getFilename(),
+                        brdDoc.toByteArray());  // can throw
+      mIsDirty = false;
+    }
 
     // save user settings
     mUserSettings->resetPlanesVisibility();
@@ -891,8 +1099,9 @@ void Board::save() {
     SExpression usrDoc(mUserSettings->serializeToDomElement(
         "librepcb_board_user_settings"));  // can throw
     mDirectory->write("settings.user.lp", usrDoc.toByteArray());  // can throw
-  } else {
+  } else if (mIsDirty) {
     mDirectory->removeDirRecursively();  // can throw
+    mIsDirty = false;
   }
 }
 
@@ -951,45 +1160,39 @@ void Board::setSelectionRect(const Point& p1, const Point& p2,
   mGraphicsScene->setSelectionRect(p1, p2);
   if (updateItems) {
     QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+    QSet<const BI_Base*> items;
+    foreach (BI_Base* item,
+             getIndexedItems(mGraphicsScene->items(
+                 rectPx, Qt::IntersectsItemBoundingRect))) {
+      if (item->isSelectable() &&
+          item->getGrabAreaScenePx().intersects(rectPx)) {
+        items.insert(item);
+      }
+    }
     foreach (BI_Device* component, mDeviceInstances) {
       BI_Footprint& footprint = component->getFootprint();
-      bool selectFootprint = footprint.isSelectable() &&
-          footprint.getGrabAreaScenePx().intersects(rectPx);
+      bool selectFootprint = items.contains(&footprint);
       footprint.setSelected(selectFootprint);
       foreach (BI_FootprintPad* pad, footprint.getPads()) {
-        bool selectPad =
-            pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
-        pad->setSelected(selectFootprint || selectPad);
+        pad->setSelected(selectFootprint || items.contains(pad));
       }
       foreach (BI_StrokeText* text, footprint.getStrokeTexts()) {
-        bool selectText = text->isSelectable() &&
-            text->getGrabAreaScenePx().intersects(rectPx);
-        text->setSelected(selectFootprint || selectText);
+        text->setSelected(selectFootprint || items.contains(text));
       }
     }
     foreach (BI_NetSegment* segment, mNetSegments) {
-      segment->setSelectionRect(rectPx);
+      segment->setSelection(items);
     }
     foreach (BI_Plane* plane, mPlanes) {
-      bool select = plane->isSelectable() &&
-          plane->getGrabAreaScenePx().intersects(rectPx);
-      plane->setSelected(select);
+      plane->setSelected(items.contains(plane));
     }
     foreach (BI_Polygon* polygon, mPolygons) {
-      bool select = polygon->isSelectable() &&
-          polygon->getGrabAreaScenePx().intersects(rectPx);
-      polygon->setSelected(select);
+      polygon->setSelected(items.contains(polygon));
     }
     foreach (BI_StrokeText* text, mStrokeTexts) {
-      bool select =
-          text->isSelectable() && text->getGrabAreaScenePx().intersects(rectPx);
-      text->setSelected(select);
-    }
-    foreach (BI_Hole* hole, mHoles) {
-      bool select =
-          hole->isSelectable() && hole->getGrabAreaScenePx().intersects(rectPx);
-      hole->setSelected(select);
+      text->setSelected(items.contains(text));
     }
+    foreach (BI_Hole* hole, mHoles) { hole->setSelected(items.contains(hole)); }
   }
 }
 
@@ -1060,6 +1263,17 @@ void Board::serialize(SExpression& root) const {
   root.appendLineBreak();
 }
 
+QList<BI_Base*> Board::getIndexedItems(
+    const QList<QGraphicsItem*>& graphicsItems) const noexcept {
+  QList<BI_Base*> items;
+  foreach (const QGraphicsItem* graphicsItem, graphicsItems) {
+    // child items (e.g. texts of footprints) are not registered
+    BI_Base* item = mItemsByGraphicsItem.value(graphicsItem, nullptr);
+    if (item) items.append(item);
+  }
+  return items;
+}
+
 void Board::updateErcMessages() noexcept {
   // type: UnplacedComponent (ComponentInstances without DeviceInstance)
   if (mIsAddedToProject) {
@@ -1094,6 +1308,11 @@ void Board::updateErcMessages() noexcept {
   }
 }
 
+void Board::netSignalRemoved(NetSignal& netsignal) noexcept {
+  // The builder must not outlive its net signal, which might be deleted now.
+  mAirWiresBuilders.remove(&netsignal);
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
@@ -67,6 +67,7 @@ class BI_StrokeText;
 class BI_Hole;
 class BI_Plane;
 class BI_AirWire;
+class BoardAirWiresBuilder;
 class BoardLayerStack;
 class BoardFabricationOutputSettings;
 class BoardUserSettings;
@@ -150,6 +151,15 @@ public:
     return *mFabricationOutputSettings;
   }
   bool isEmpty() const noexcept;
+
+  /**
+   * @brief Check whether the board needs to be serialized on the next #save()
+   *
+   * A board is dirty after loading it (so the first save always writes all
+   * files, e.g. to upgrade the file format) and as soon as it is modified
+   * with #setDirty(). #save() resets the flag.
+   */
+  bool isDirty() const noexcept { return mIsDirty; }
   QList<BI_Base*> getItemsAtScenePos(const Point& pos) const noexcept;
   QList<BI_Via*> getViasAtScenePos(
       const Point& pos, const QSet<const NetSignal*>& netsignals = {}) const
@@ -180,6 +190,18 @@ public:
   // Setters: General
   void setGridProperties(const GridProperties& grid) noexcept;
 
+  /**
+   * @brief Mark the board as modified
+   *
+   * Must be called by all undo commands which modify the board or one of its
+   * items. Adding or removing top-level items (devices, net segments, planes,
+   * polygons, stroke texts and holes) as well as modifying them with their
+   * setters is tracked by the board itself, since editors also modify items
+   * directly (e.g. while drawing a trace), possibly after the project was
+   * saved in the middle of the operation.
+   */
+  void setDirty() noexcept { mIsDirty = true; }
+
   // Getters: Attributes
   const Uuid& getUuid() const noexcept { return mUuid; }
   const ElementName& getName() const noexcept { return mName; }
@@ -210,6 +232,50 @@ public:
   void removePlane(BI_Plane& plane);
   void rebuildAllPlanes() noexcept;
 
+  /**
+   * @brief Rebuild only the planes affected by invalidated areas
+   *
+   * All planes which intersect with an area passed to #invalidatePlanes()
+   * since the last plane rebuild are rebuilt, as well as planes with lower
+   * priority on the same layer which overlap a rebuilt plane. All other
+   * planes keep their fragments.
+   */
+  void rebuildInvalidatedPlanes() noexcept;
+
+  /**
+   * @brief Mark the whole board as modified, i.e. all planes need a rebuild
+   */
+  void invalidatePlanes() noexcept { mAllPlanesInvalidated = true; }
+
+  /**
+   * @brief Mark an area as modified, i.e. planes within it need a rebuild
+   *
+   * @param areaPx  The modified area in scene pixels.
+   */
+  void invalidatePlanes(const QRectF& areaPx) noexcept;
+  void invalidatePlanes(const BI_Device& device) noexcept;
+  void invalidatePlanes(const BI_NetSegment& netsegment) noexcept;
+  void invalidatePlanes(const BI_Via& via) noexcept;
+  void invalidatePlanes(const BI_NetPoint& netpoint) noexcept;
+  void invalidatePlanes(const BI_NetLine& netline) noexcept;
+
+  // Spatial Index Methods
+
+  /**
+   * @brief Register the graphics item of a board item in the spatial index
+   *
+   * All `*AtScenePos()` queries and #setSelectionRect() look up candidate
+   * items by their bounding rect in the index of the graphics scene, which
+   * is updated by Qt whenever a graphics item is added, moved or removed.
+   * This method maps such a graphics item back to its board item.
+   *
+   * @param graphicsItem  The graphics item, already added to the scene.
+   * @param item          The board item represented by the graphics item.
+   */
+  void registerGraphicsItem(const QGraphicsItem& graphicsItem,
+                            BI_Base& item) noexcept;
+  void unregisterGraphicsItem(const QGraphicsItem& graphicsItem) noexcept;
+
   // Polygon Methods
   const QList<BI_Polygon*>& getPolygons() const noexcept { return mPolygons; }
   void addPolygon(BI_Polygon& polygon);
@@ -290,11 +356,30 @@ signals:
   void deviceAdded(BI_Device& comp);
   void deviceRemoved(BI_Device& comp);
 
+  /**
+   * @brief The copper of a net signal was modified
+   *
+   * Used to let the live design rule check know what needs to be checked
+   * again, so it doesn't need to compare the whole board with its last run.
+   *
+   * @param netsignal   The modified net signal, or `nullptr` for copper
+   *                    objects without net signal.
+   */
+  void copperModified(const NetSignal* netsignal);
+
+  /**
+   * @brief A device was added, removed, moved, rotated or mirrored
+   */
+  void deviceModified(const BI_Device& device);
+
 private:
   Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
         const Version& fileFormat, bool create, const QString& newName);
   void updateIcon() noexcept;
   void updateErcMessages() noexcept;
+  void netSignalRemoved(NetSignal& netsignal) noexcept;
+  QList<BI_Base*> getIndexedItems(
+      const QList<QGraphicsItem*>& graphicsItems) const noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -303,6 +388,7 @@ private:
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   std::unique_ptr<TransactionalDirectory> mDirectory;
   bool mIsAddedToProject;
+  bool mIsDirty;  ///< see #isDirty()
 
   QScopedPointer<GraphicsScene> mGraphicsScene;
   QScopedPointer<BoardLayerStack> mLayerStack;
@@ -312,6 +398,9 @@ private:
   QScopedPointer<BoardUserSettings> mUserSettings;
   QRectF mViewRect;
   QSet<NetSignal*> mScheduledNetSignalsForAirWireRebuild;
+  QList<QRectF> mInvalidatedPlaneAreasPx;  ///< see #invalidatePlanes()
+  bool mAllPlanesInvalidated;  ///< see #invalidatePlanes()
+  QHash<const QGraphicsItem*, BI_Base*> mItemsByGraphicsItem;
 
   // Attributes
   Uuid mUuid;
@@ -327,6 +416,8 @@ private:
   QList<BI_StrokeText*> mStrokeTexts;
   QList<BI_Hole*> mHoles;
   QMultiHash<NetSignal*, BI_AirWire*> mAirWires;
+  QHash<NetSignal*, std::shared_ptr<BoardAirWiresBuilder>>
+      mAirWiresBuilders;  ///< to update airwires incrementally
 
   // ERC messages
   QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
@@ -40,6 +40,8 @@
 
 #include <QtCore>
 
+#include <numeric>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -50,92 +52,175 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BoardAirWiresBuilder::BoardAirWiresBuilder(const Board& board,
-                                           const NetSignal& netsignal) noexcept
-  : mBoard(board), mNetSignal(netsignal) {
-}
-
-BoardAirWiresBuilder::~BoardAirWiresBuilder() noexcept {
-}
-
-/*******************************************************************************
- *  General Methods
- ******************************************************************************/
-
-QVector<QPair<Point, Point>> BoardAirWiresBuilder::buildAirWires() const {
-  AirWiresBuilder builder;
-  QHash<int, std::pair<Point, QString>> pointLayerMap;  // ID -> (point, layer)
-  QHash<const BI_NetLineAnchor*, int> anchorMap;  // anchor -> ID
+BoardAirWiresBuilder::BoardAirWiresBuilder(
+    const Board& board, const NetSignal& netsignal) noexcept {
+  QHash<const BI_NetLineAnchor*, int> anchorMap;  // anchor -> index
 
   // pads
-  foreach (ComponentSignalInstance* cmpSig, mNetSignal.getComponentSignals()) {
+  foreach (ComponentSignalInstance* cmpSig, netsignal.getComponentSignals()) {
     Q_ASSERT(cmpSig);
     foreach (BI_FootprintPad* pad, cmpSig->getRegisteredFootprintPads()) {
-      if (&pad->getBoard() != &mBoard) continue;
-      const Point& pos = pad->getPosition();
-      int id = builder.addPoint(pos);
-      pointLayerMap[id] = std::make_pair(pos,
-                                         (pad->getLibPad().getBoardSide() ==
-                                          library::FootprintPad::BoardSide::THT)
-                                             ? QString()  // on all layers
-                                             : pad->getLayerName());
-      anchorMap[pad] = id;
+      if (&pad->getBoard() != &board) continue;
+      anchorMap[pad] = mAnchors.count();
+      mAnchors.append(Anchor{pad->getPosition(),
+                             (pad->getLibPad().getBoardSide() ==
+                              library::FootprintPad::BoardSide::THT)
+                                 ? QString()  // on all layers
+                                 : pad->getLayerName()});
     }
   }
 
   // vias, netpoints, netlines
-  foreach (const BI_NetSegment* netsegment, mNetSignal.getBoardNetSegments()) {
+  foreach (const BI_NetSegment* netsegment, netsignal.getBoardNetSegments()) {
     Q_ASSERT(netsegment);
-    if (&netsegment->getBoard() != &mBoard) continue;
+    if (&netsegment->getBoard() != &board) continue;
     foreach (const BI_Via* via, netsegment->getVias()) {
       Q_ASSERT(via);
-      const Point& pos = via->getPosition();
-      int id = builder.addPoint(pos);
-      pointLayerMap[id] = std::make_pair(pos, QString());  // on all layers
-      anchorMap[via] = id;
+      anchorMap[via] = mAnchors.count();
+      mAnchors.append(Anchor{via->getPosition(), QString()});  // all layers
     }
     foreach (const BI_NetPoint* netpoint, netsegment->getNetPoints()) {
       Q_ASSERT(netpoint);
       if (const GraphicsLayer* layer = netpoint->getLayerOfLines()) {
-        Point pos = netpoint->getPosition();
-        int id = builder.addPoint(pos);
-        pointLayerMap[id] = std::make_pair(pos, layer->getName());
-        anchorMap[netpoint] = id;
+        anchorMap[netpoint] = mAnchors.count();
+        mAnchors.append(Anchor{netpoint->getPosition(), layer->getName()});
       }
     }
     foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
       Q_ASSERT(netline);
       Q_ASSERT(anchorMap.contains(&netline->getStartPoint()));
       Q_ASSERT(anchorMap.contains(&netline->getEndPoint()));
-      builder.addEdge(anchorMap[&netline->getStartPoint()],
-                      anchorMap[&netline->getEndPoint()]);
+      mConnections.append(qMakePair(anchorMap[&netline->getStartPoint()],
+                                    anchorMap[&netline->getEndPoint()]));
     }
   }
 
-  // determine connections made by planes
-  foreach (const BI_Plane* plane, mNetSignal.getBoardPlanes()) {
+  // planes (the fragments index is implicitly shared, so no deep copy here)
+  foreach (const BI_Plane* plane, netsignal.getBoardPlanes()) {
     Q_ASSERT(plane);
-    if (&plane->getBoard() != &mBoard) continue;
-    foreach (const Path& fragment, plane->getFragments()) {
-      int lastId = -1;
-      QHashIterator<int, std::pair<Point, QString>> i(pointLayerMap);
-      while (i.hasNext()) {
-        i.next();
-        const Point& pos = i.value().first;
-        const QString& pointLayer = i.value().second;
-        if (pointLayer.isNull() || (pointLayer == plane->getLayerName())) {
-          if (fragment.toQPainterPathPx().contains(pos.toPxQPointF())) {
-            if (lastId >= 0) {
-              builder.addEdge(lastId, i.key());
-            }
-            lastId = i.key();
+    if (&plane->getBoard() != &board) continue;
+    if (plane->getFragmentsIndex().count() == 0) continue;
+    mPlanes.append(Plane{*plane->getLayerName(), plane->getFragmentsIndex()});
+  }
+}
+
+BoardAirWiresBuilder::~BoardAirWiresBuilder() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QVector<QPair<Point, Point>> BoardAirWiresBuilder::buildAirWires(
+    BoardAirWiresBuilder* previous) noexcept {
+  // Note: This might be executed in a worker thread, so the board must not be
+  // accessed here!
+  mAllConnections = mConnections;
+
+  // determine connections made by planes
+  foreach (const Plane& plane, mPlanes) {
+    QHash<int, int> lastAnchorOfFragment;  // fragment index -> anchor index
+    for (int i = 0; i < mAnchors.count(); ++i) {
+      const Anchor& anchor = mAnchors.at(i);
+      if (anchor.layer.isNull() || (anchor.layer == plane.layer)) {
+        int fragment = plane.fragments.indexOf(anchor.position);
+        if (fragment >= 0) {
+          auto it = lastAnchorOfFragment.find(fragment);
+          if (it != lastAnchorOfFragment.end()) {
+            mAllConnections.append(qMakePair(it.value(), i));
           }
+          lastAnchorOfFragment[fragment] = i;
         }
       }
     }
   }
 
-  return builder.buildAirWires();
+  // Try to update the airwires of the previous build, otherwise build them
+  // from scratch.
+  if ((!previous) || (!takeOverPreviousBuilder(*previous))) {
+    mBuilder.reset(new AirWiresBuilder());
+    mIds.clear();
+    mIds.reserve(mAnchors.count());
+    foreach (const Anchor& anchor, mAnchors) {
+      mIds.append(mBuilder->addPoint(anchor.position));
+    }
+  }
+  foreach (const auto& connection, mAllConnections) {
+    mBuilder->addEdge(mIds.at(connection.first), mIds.at(connection.second));
+  }
+  return mBuilder->buildAirWires();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool BoardAirWiresBuilder::takeOverPreviousBuilder(
+    BoardAirWiresBuilder& previous) noexcept {
+  if (!previous.mBuilder) {
+    return false;
+  }
+
+  // Map the anchors of the previous build to the current anchors. Anchors
+  // which don't exist anymore (i.e. moved or removed) are mapped to -1.
+  QMultiHash<QPair<Point, QString>, int> anchorsByKey;
+  for (int i = 0; i < mAnchors.count(); ++i) {
+    const Anchor& anchor = mAnchors.at(i);
+    anchorsByKey.insert(qMakePair(anchor.position, anchor.layer), i);
+  }
+  QVector<int> mapping;  // previous anchor index -> current anchor index
+  mapping.reserve(previous.mAnchors.count());
+  foreach (const Anchor& anchor, previous.mAnchors) {
+    auto it = anchorsByKey.find(qMakePair(anchor.position, anchor.layer));
+    if (it != anchorsByKey.end()) {
+      mapping.append(it.value());
+      anchorsByKey.erase(it);
+    } else {
+      mapping.append(-1);
+    }
+  }
+
+  // All previous connections must still exist (directly or indirectly) since
+  // the incremental mode can only add connections, not remove them.
+  std::vector<int> parents(mAnchors.count());
+  std::iota(parents.begin(), parents.end(), 0);
+  auto findRoot = [&parents](int i) {
+    while (parents[i] != i) {
+      i = parents[i] = parents[parents[i]];
+    }
+    return i;
+  };
+  foreach (const auto& connection, mAllConnections) {
+    parents[findRoot(connection.first)] = findRoot(connection.second);
+  }
+  // Connections of removed anchors are removed together with the anchors.
+  foreach (const auto& connection, previous.mAllConnections) {
+    int anchor1 = mapping.at(connection.first);
+    int anchor2 = mapping.at(connection.second);
+    if ((anchor1 >= 0) && (anchor2 >= 0) &&
+        (findRoot(anchor1) != findRoot(anchor2))) {
+      return false;  // connection removed
+    }
+  }
+
+  // Take over the previous builder, remove the anchors which don't exist
+  // anymore and add the new ones. The connections are added afterwards,
+  // where already connected anchors don't cost anything.
+  mBuilder = std::move(previous.mBuilder);
+  mIds = QVector<int>(mAnchors.count(), -1);
+  for (int i = 0; i < mapping.count(); ++i) {
+    if (mapping.at(i) >= 0) {
+      mIds[mapping.at(i)] = previous.mIds.at(i);
+    } else {
+      mBuilder->removePoint(previous.mIds.at(i));
+    }
+  }
+  for (int i = 0; i < mAnchors.count(); ++i) {
+    if (mIds.at(i) < 0) {
+      mIds[i] = mBuilder->addPoint(mAnchors.at(i).position);
+    }
+  }
+  return true;
 }
 
 /*******************************************************************************
@@ -23,14 +23,20 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include <librepcb/common/algorithm/polygonindex.h>
 #include <librepcb/common/units/point.h>
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
+
+class AirWiresBuilder;
+
 namespace project {
 
 class NetSignal;
@@ -42,6 +48,18 @@ class Board;
 
 /**
  * @brief The BoardAirWiresBuilder class
+ *
+ * All required data of the board is collected in the constructor, so
+ * #buildAirWires() does not access the board anymore. This allows to build
+ * the airwires of many net signals in parallel worker threads, as long as
+ * the builders are constructed in the main thread.
+ *
+ * To avoid rebuilding the airwires from scratch on every modification, the
+ * builder of the previous build can be passed to #buildAirWires(). If no
+ * connections were removed since then, its airwires are updated
+ * incrementally: added anchors are inserted and moved or removed anchors are
+ * removed (and inserted again at their new position). This way, moving the
+ * net points while drawing traces does not rebuild all airwires.
  */
 class BoardAirWiresBuilder final {
 public:
@@ -52,14 +70,44 @@ public:
   ~BoardAirWiresBuilder() noexcept;
 
   // General Methods
-  QVector<QPair<Point, Point>> buildAirWires() const;
+
+  /**
+   * @brief Build the airwires
+   *
+   * @param previous  The builder of the last build of the same net signal
+   *                  (optional). Its state is taken over if possible, so it
+   *                  must not be used for building anymore afterwards.
+   *
+   * @return The airwires
+   */
+  QVector<QPair<Point, Point>> buildAirWires(
+      BoardAirWiresBuilder* previous = nullptr) noexcept;
 
   // Operator Overloadings
   BoardAirWiresBuilder& operator=(const BoardAirWiresBuilder& rhs) = delete;
 
+private:  // Types
+  struct Anchor {
+    Point position;
+    QString layer;  ///< null if the anchor is on all layers
+  };
+  struct Plane {
+    QString layer;
+    PolygonIndex fragments;
+  };
+
+private:  // Methods
+  bool takeOverPreviousBuilder(BoardAirWiresBuilder& previous) noexcept;
+
 private:  // Data
-  const Board& mBoard;
-  const NetSignal& mNetSignal;
+  QVector<Anchor> mAnchors;
+  QVector<QPair<int, int>> mConnections;  ///< indices in #mAnchors
+  QVector<Plane> mPlanes;
+
+  // State of the last build
+  QVector<QPair<int, int>> mAllConnections;  ///< including planes
+  std::unique_ptr<AirWiresBuilder> mBuilder;
+  QVector<int> mIds;  ///< anchor index -> point ID in #mBuilder
 };
 
 /*******************************************************************************
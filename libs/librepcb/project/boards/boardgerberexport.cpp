@@ -43,11 +43,13 @@
 #include <librepcb/common/boarddesignrules.h>
 #include <librepcb/common/cam/excellongenerator.h>
 #include <librepcb/common/cam/gerbergenerator.h>
+#include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/geometry/hole.h>
 #include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -83,28 +85,100 @@ FilePath BoardGerberExport::getOutputDirectory() const noexcept {
  *  General Methods
  ******************************************************************************/
 
-void BoardGerberExport::exportAllLayers() const {
+void BoardGerberExport::exportAllLayers(int jobs) const {
   mWrittenFiles.clear();
 
+  // Determine all files to export. The output file paths are determined here
+  // since the attribute substitution (see #mCurrentInnerCopperLayer) is not
+  // thread-safe.
+  QVector<OutputFile> files;
   if (mSettings->getMergeDrillFiles()) {
-    exportDrills();
+    files.append(OutputFile{getOutputFilePath(mSettings->getSuffixDrills()),
+                            [this]() { return exportDrills(); }});
   } else {
-    exportDrillsNpth();
-    exportDrillsPth();
-  }
-  exportLayerBoardOutlines();
-  exportLayerTopCopper();
-  exportLayerInnerCopper();
-  exportLayerBottomCopper();
-  exportLayerTopSolderMask();
-  exportLayerBottomSolderMask();
-  exportLayerTopSilkscreen();
-  exportLayerBottomSilkscreen();
+    files.append(
+        OutputFile{getOutputFilePath(mSettings->getSuffixDrillsNpth()),
+                   [this]() { return exportDrillsNpth(); }});
+    files.append(OutputFile{getOutputFilePath(mSettings->getSuffixDrillsPth()),
+                            [this]() { return exportDrillsPth(); }});
+  }
+  files.append(OutputFile{getOutputFilePath(mSettings->getSuffixOutlines()),
+                          [this]() { return exportLayerBoardOutlines(); }});
+  files.append(OutputFile{getOutputFilePath(mSettings->getSuffixCopperTop()),
+                          [this]() { return exportLayerTopCopper(); }});
+  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
+    mCurrentInnerCopperLayer = i;  // used for attribute provider
+    files.append(
+        OutputFile{getOutputFilePath(mSettings->getSuffixCopperInner()),
+                   [this, i]() { return exportLayerInnerCopper(i); }});
+  }
+  mCurrentInnerCopperLayer = 0;
+  files.append(OutputFile{getOutputFilePath(mSettings->getSuffixCopperBot()),
+                          [this]() { return exportLayerBottomCopper(); }});
+  files.append(
+      OutputFile{getOutputFilePath(mSettings->getSuffixSolderMaskTop()),
+                 [this]() { return exportLayerTopSolderMask(); }});
+  files.append(
+      OutputFile{getOutputFilePath(mSettings->getSuffixSolderMaskBot()),
+                 [this]() { return exportLayerBottomSolderMask(); }});
+  files.append(
+      OutputFile{getOutputFilePath(mSettings->getSuffixSilkscreenTop()),
+                 [this]() { return exportLayerTopSilkscreen(); }});
+  files.append(
+      OutputFile{getOutputFilePath(mSettings->getSuffixSilkscreenBot()),
+                 [this]() { return exportLayerBottomSilkscreen(); }});
   if (mSettings->getEnableSolderPasteTop()) {
-    exportLayerTopSolderPaste();
+    files.append(
+        OutputFile{getOutputFilePath(mSettings->getSuffixSolderPasteTop()),
+                   [this]() { return exportLayerTopSolderPaste(); }});
   }
   if (mSettings->getEnableSolderPasteBot()) {
-    exportLayerBottomSolderPaste();
+    files.append(
+        OutputFile{getOutputFilePath(mSettings->getSuffixSolderPasteBot()),
+                   [this]() { return exportLayerBottomSolderPaste(); }});
+  }
+
+  // Generate the file contents. Each worker picks the next file which is not
+  // generated yet, so the result does not depend on the number of workers.
+  // The board is only read (and this method blocks until all workers are
+  // finished), thus no locking is needed.
+  QVector<QByteArray> contents(files.count());
+  QVector<std::shared_ptr<Exception>> errors(files.count());
+  QAtomicInt nextIndex(0);
+  auto worker = [&]() {
+    int index;
+    while ((index = nextIndex.fetchAndAddOrdered(1)) < files.count()) {
+      try {
+        contents[index] = files.at(index).generate();  // can throw
+      } catch (const Exception& e) {
+        errors[index].reset(e.clone());
+      }
+    }
+  };
+  if (jobs <= 0) {
+    jobs = QThread::idealThreadCount();
+  }
+  jobs = qMin(jobs, files.count());
+  if (jobs <= 1) {
+    worker();
+  } else {
+    QVector<QFuture<void>> futures;
+    for (int i = 0; i < jobs; ++i) {
+      futures.append(QtConcurrent::run(worker));
+    }
+    foreach (QFuture<void> future, futures) { future.waitForFinished(); }
+  }
+
+  // Write the files in a deterministic order and fail on the first error, just
+  // as if the files were generated one after another.
+  for (int i = 0; i < files.count(); ++i) {
+    if (errors.at(i)) {
+      errors.at(i)->raise();
+    }
+    if (!contents.at(i).isNull()) {
+      FileUtils::writeFile(files.at(i).filePath, contents.at(i));  // can throw
+      mWrittenFiles.append(files.at(i).filePath);
+    }
   }
 }
 
@@ -130,18 +204,15 @@ QVector<const AttributeProvider*>
  *  Private Methods
  ******************************************************************************/
 
-void BoardGerberExport::exportDrills() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixDrills());
+QByteArray BoardGerberExport::exportDrills() const {
   ExcellonGenerator gen;
   drawPthDrills(gen);
   drawNpthDrills(gen);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toStr().toLatin1();
 }
 
-void BoardGerberExport::exportDrillsNpth() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixDrillsNpth());
+QByteArray BoardGerberExport::exportDrillsNpth() const {
   ExcellonGenerator gen;
   int count = drawNpthDrills(gen);
   if (count > 0) {
@@ -150,95 +221,77 @@ void BoardGerberExport::exportDrillsNpth() const {
     // this file only if it's really needed. Maybe this avoids unnecessary
     // issues with manufacturers...
     gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    return gen.toStr().toLatin1();
+  } else {
+    return QByteArray();
   }
 }
 
-void BoardGerberExport::exportDrillsPth() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixDrillsPth());
+QByteArray BoardGerberExport::exportDrillsPth() const {
   ExcellonGenerator gen;
   drawPthDrills(gen);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toStr().toLatin1();
 }
 
-void BoardGerberExport::exportLayerBoardOutlines() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixOutlines());
+QByteArray BoardGerberExport::exportLayerBoardOutlines() const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBoardOutlines);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toByteArray();
 }
 
-void BoardGerberExport::exportLayerTopCopper() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixCopperTop());
+QByteArray BoardGerberExport::exportLayerTopCopper() const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopCopper);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toByteArray();
 }
 
-void BoardGerberExport::exportLayerBottomCopper() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixCopperBot());
+QByteArray BoardGerberExport::exportLayerBottomCopper() const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotCopper);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toByteArray();
 }
 
-void BoardGerberExport::exportLayerInnerCopper() const {
-  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
-    mCurrentInnerCopperLayer = i;  // used for attribute provider
-    FilePath fp = getOutputFilePath(mSettings->getSuffixCopperInner());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::getInnerLayerName(i));
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-  mCurrentInnerCopperLayer = 0;
+QByteArray BoardGerberExport::exportLayerInnerCopper(int number) const {
+  GerberGenerator gen(
+      mProject.getMetadata().getName() % " - " % mBoard.getName(),
+      mBoard.getUuid(), mProject.getMetadata().getVersion());
+  drawLayer(gen, GraphicsLayer::getInnerLayerName(number));
+  gen.generate();
+  return gen.toByteArray();
 }
 
-void BoardGerberExport::exportLayerTopSolderMask() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderMaskTop());
+QByteArray BoardGerberExport::exportLayerTopSolderMask() const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopStopMask);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toByteArray();
 }
 
-void BoardGerberExport::exportLayerBottomSolderMask() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderMaskBot());
+QByteArray BoardGerberExport::exportLayerBottomSolderMask() const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotStopMask);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toByteArray();
 }
 
-void BoardGerberExport::exportLayerTopSilkscreen() const {
+QByteArray BoardGerberExport::exportLayerTopSilkscreen() const {
   QStringList layers = mSettings->getSilkscreenLayersTop();
   if (layers.count() >
       0) {  // don't create silkscreen file if no layers selected
-    FilePath fp = getOutputFilePath(mSettings->getSuffixSilkscreenTop());
     GerberGenerator gen(
         mProject.getMetadata().getName() % " - " % mBoard.getName(),
         mBoard.getUuid(), mProject.getMetadata().getVersion());
@@ -246,16 +299,16 @@ void BoardGerberExport::exportLayerTopSilkscreen() const {
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
     drawLayer(gen, GraphicsLayer::sTopStopMask);
     gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    return gen.toByteArray();
+  } else {
+    return QByteArray();
   }
 }
 
-void BoardGerberExport::exportLayerBottomSilkscreen() const {
+QByteArray BoardGerberExport::exportLayerBottomSilkscreen() const {
   QStringList layers = mSettings->getSilkscreenLayersBot();
   if (layers.count() >
       0) {  // don't create silkscreen file if no layers selected
-    FilePath fp = getOutputFilePath(mSettings->getSuffixSilkscreenBot());
     GerberGenerator gen(
         mProject.getMetadata().getName() % " - " % mBoard.getName(),
         mBoard.getUuid(), mProject.getMetadata().getVersion());
@@ -263,31 +316,28 @@ void BoardGerberExport::exportLayerBottomSilkscreen() const {
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
     drawLayer(gen, GraphicsLayer::sBotStopMask);
     gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    return gen.toByteArray();
+  } else {
+    return QByteArray();
   }
 }
 
-void BoardGerberExport::exportLayerTopSolderPaste() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderPasteTop());
+QByteArray BoardGerberExport::exportLayerTopSolderPaste() const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopSolderPaste);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toByteArray();
 }
 
-void BoardGerberExport::exportLayerBottomSolderPaste() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderPasteBot());
+QByteArray BoardGerberExport::exportLayerBottomSolderPaste() const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotSolderPaste);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return gen.toByteArray();
 }
 
 int BoardGerberExport::drawNpthDrills(ExcellonGenerator& gen) const {
@@ -30,6 +30,7 @@
 #include <QtCore>
 
 #include <algorithm>
+#include <functional>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -75,7 +76,16 @@ public:
   }
 
   // General Methods
-  void exportAllLayers() const;
+
+  /**
+   * @brief Export all Gerber and Excellon files
+   *
+   * @param jobs    Number of files to generate in parallel. If <= 0, the
+   *                number of CPU cores is used. If 1, all files are generated
+   *                in the calling thread. The generated files are the same in
+   *                any case.
+   */
+  void exportAllLayers(int jobs = 0) const;
 
   // Inherited from AttributeProvider
   /// @copydoc librepcb::AttributeProvider::getBuiltInAttributeValue()
@@ -91,20 +101,26 @@ signals:
   void attributesChanged() override;
 
 private:
+  // Types
+  struct OutputFile {
+    FilePath filePath;
+    std::function<QByteArray()> generate;  ///< Null result = no file
+  };
+
   // Private Methods
-  void exportDrills() const;
-  void exportDrillsNpth() const;
-  void exportDrillsPth() const;
-  void exportLayerBoardOutlines() const;
-  void exportLayerTopCopper() const;
-  void exportLayerInnerCopper() const;
-  void exportLayerBottomCopper() const;
-  void exportLayerTopSolderMask() const;
-  void exportLayerBottomSolderMask() const;
-  void exportLayerTopSilkscreen() const;
-  void exportLayerBottomSilkscreen() const;
-  void exportLayerTopSolderPaste() const;
-  void exportLayerBottomSolderPaste() const;
+  QByteArray exportDrills() const;
+  QByteArray exportDrillsNpth() const;
+  QByteArray exportDrillsPth() const;
+  QByteArray exportLayerBoardOutlines() const;
+  QByteArray exportLayerTopCopper() const;
+  QByteArray exportLayerInnerCopper(int number) const;
+  QByteArray exportLayerBottomCopper() const;
+  QByteArray exportLayerTopSolderMask() const;
+  QByteArray exportLayerBottomSolderMask() const;
+  QByteArray exportLayerTopSilkscreen() const;
+  QByteArray exportLayerBottomSilkscreen() const;
+  QByteArray exportLayerTopSolderPaste() const;
+  QByteArray exportLayerBottomSolderPaste() const;
 
   int drawNpthDrills(ExcellonGenerator& gen) const;
   int drawPthDrills(ExcellonGenerator& gen) const;
@@ -38,6 +38,7 @@
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -50,8 +51,9 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BoardPlaneFragmentsBuilder::BoardPlaneFragmentsBuilder(BI_Plane& plane) noexcept
-  : mPlane(plane) {
+BoardPlaneFragmentsBuilder::BoardPlaneFragmentsBuilder(
+    BI_Plane& plane, const PlaneFragments* rebuiltFragments) noexcept
+  : mPlane(plane), mRebuiltFragments(rebuiltFragments) {
 }
 
 BoardPlaneFragmentsBuilder::~BoardPlaneFragmentsBuilder() noexcept {
@@ -80,6 +82,42 @@ QVector<Path> BoardPlaneFragmentsBuilder::buildFragments() noexcept {
   }
 }
 
+BoardPlaneFragmentsBuilder::PlaneFragments
+    BoardPlaneFragmentsBuilder::buildAllFragments(
+        const QList<BI_Plane*>& planes) noexcept {
+  // group planes by layer, sorted by priority (highest priority first)
+  QMap<QString, QList<BI_Plane*>> planesPerLayer;
+  foreach (BI_Plane* plane, planes) {
+    planesPerLayer[*plane->getLayerName()].append(plane);
+  }
+  for (QList<BI_Plane*>& layerPlanes : planesPerLayer) {
+    std::sort(layerPlanes.begin(), layerPlanes.end(),
+              [](const BI_Plane* p1, const BI_Plane* p2) {
+                return !(*p1 < *p2);
+              });
+  }
+
+  // build the planes of each layer in a separate thread
+  QList<QFuture<PlaneFragments>> futures;
+  for (const QList<BI_Plane*>& layerPlanes : planesPerLayer) {
+    futures.append(QtConcurrent::run([layerPlanes]() -> PlaneFragments {
+      PlaneFragments fragments;
+      foreach (BI_Plane* plane, layerPlanes) {
+        BoardPlaneFragmentsBuilder builder(*plane, &fragments);
+        fragments.insert(plane, builder.buildFragments());
+      }
+      return fragments;
+    }));
+  }
+
+  // wait until all layers are built and merge the results
+  PlaneFragments result;
+  for (QFuture<PlaneFragments>& future : futures) {
+    result.unite(future.result());  // blocks until finished
+  }
+  return result;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -142,8 +180,12 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects() {
     if (*plane < mPlane) continue;  // ignore planes with lower priority
     if (plane->getLayerName() != mPlane.getLayerName()) continue;
     if (&plane->getNetSignal() == &mPlane.getNetSignal()) continue;
+    QVector<Path> fragments = plane->getFragments();
+    if (mRebuiltFragments && mRebuiltFragments->contains(plane)) {
+      fragments = mRebuiltFragments->value(plane);
+    }
     ClipperLib::Paths paths =
-        ClipperHelpers::convert(plane->getFragments(), maxArcTolerance());
+        ClipperHelpers::convert(fragments, maxArcTolerance());
     ClipperHelpers::offset(paths, *mPlane.getMinClearance(),
                            maxArcTolerance());  // can throw
     c.AddPaths(paths, ClipperLib::ptClip, true);
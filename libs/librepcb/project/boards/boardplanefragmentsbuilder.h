@@ -47,15 +47,49 @@ class BI_FootprintPad;
  */
 class BoardPlaneFragmentsBuilder final {
 public:
+  // Types
+  typedef QHash<const BI_Plane*, QVector<Path>> PlaneFragments;
+
   // Constructors / Destructor
   BoardPlaneFragmentsBuilder() = delete;
   BoardPlaneFragmentsBuilder(const BoardPlaneFragmentsBuilder& other) = delete;
-  BoardPlaneFragmentsBuilder(BI_Plane& plane) noexcept;
+
+  /**
+   * @brief Constructor
+   *
+   * @param plane             The plane to build the fragments for.
+   * @param rebuiltFragments  Optional fragments of other planes which were
+   *                          rebuilt but not applied to their ::BI_Plane yet.
+   *                          For all other planes, their current fragments
+   *                          are used.
+   */
+  explicit BoardPlaneFragmentsBuilder(
+      BI_Plane& plane,
+      const PlaneFragments* rebuiltFragments = nullptr) noexcept;
   ~BoardPlaneFragmentsBuilder() noexcept;
 
   // General Methods
   QVector<Path> buildFragments() noexcept;
 
+  /**
+   * @brief Build the fragments of several planes concurrently
+   *
+   * A plane only depends on planes with higher priority on the same layer.
+   * So the planes of each layer are built in priority order, but the layers
+   * are built in parallel on the global thread pool. This method blocks until
+   * all planes are built, the board must not be modified in the meantime.
+   *
+   * @note  The planes are not modified, the caller is responsible to apply
+   *        the returned fragments (see ::librepcb::project::BI_Plane::
+   *        setFragments()). This allows to publish all results at once.
+   *
+   * @param planes  The planes to build.
+   *
+   * @return The built fragments of each passed plane.
+   */
+  static PlaneFragments buildAllFragments(
+      const QList<BI_Plane*>& planes) noexcept;
+
   // Operator Overloadings
   BoardPlaneFragmentsBuilder& operator=(const BoardPlaneFragmentsBuilder& rhs) =
       delete;
@@ -83,6 +117,7 @@ private:  // Methods
 
 private:  // Data
   BI_Plane& mPlane;
+  const PlaneFragments* mRebuiltFragments;
   ClipperLib::Paths mConnectedNetSignalAreas;
   ClipperLib::Paths mResult;
 };
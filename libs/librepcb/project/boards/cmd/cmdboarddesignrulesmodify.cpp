@@ -60,12 +60,16 @@ bool CmdBoardDesignRulesModify::performExecute() {
 }
 
 void CmdBoardDesignRulesModify::performUndo() {
+  mBoard.setDirty();
   mBoard.getDesignRules() = mOldRules;
+  mBoard.invalidatePlanes();  // clearances might have been changed
   emit mBoard.attributesChanged();
 }
 
 void CmdBoardDesignRulesModify::performRedo() {
+  mBoard.setDirty();
   mBoard.getDesignRules() = mNewRules;
+  mBoard.invalidatePlanes();  // clearances might have been changed
   emit mBoard.attributesChanged();
 }
 
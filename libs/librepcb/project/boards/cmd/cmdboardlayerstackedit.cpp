@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardlayerstackedit.h"
 
+#include "../board.h"
 #include "../boardlayerstack.h"
 
 #include <QtCore>
@@ -68,11 +69,15 @@ bool CmdBoardLayerStackEdit::performExecute() {
 }
 
 void CmdBoardLayerStackEdit::performUndo() {
+  mLayerStack.getBoard().setDirty();
   mLayerStack.setInnerLayerCount(mOldInnerLayerCount);
+  mLayerStack.getBoard().invalidatePlanes();
 }
 
 void CmdBoardLayerStackEdit::performRedo() {
+  mLayerStack.getBoard().setDirty();
   mLayerStack.setInnerLayerCount(mNewInnerLayerCount);
+  mLayerStack.getBoard().invalidatePlanes();
 }
 
 /*******************************************************************************
@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "cmdboardnetlineedit.h"
 
+#include "../board.h"
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -71,13 +73,19 @@ bool CmdBoardNetLineEdit::performExecute() {
 }
 
 void CmdBoardNetLineEdit::performUndo() {
+  mNetLine.getBoard().setDirty();
+  mNetLine.getBoard().invalidatePlanes(mNetLine);
   mNetLine.setLayer(*mOldLayer);
   mNetLine.setWidth(mOldWidth);
+  mNetLine.getBoard().invalidatePlanes(mNetLine);
 }
 
 void CmdBoardNetLineEdit::performRedo() {
+  mNetLine.getBoard().setDirty();
+  mNetLine.getBoard().invalidatePlanes(mNetLine);
   mNetLine.setLayer(*mNewLayer);
   mNetLine.setWidth(mNewWidth);
+  mNetLine.getBoard().invalidatePlanes(mNetLine);
 }
 
 /*******************************************************************************
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardnetpointedit.h"
 
+#include "../board.h"
 #include "../items/bi_netpoint.h"
 
 #include <QtCore>
@@ -41,6 +42,8 @@ CmdBoardNetPointEdit::CmdBoardNetPointEdit(BI_NetPoint& point) noexcept
     mNetPoint(point),
     mOldPos(point.getPosition()),
     mNewPos(mOldPos) {
+  // the item may be modified immediately, so remember its current area
+  mNetPoint.getBoard().invalidatePlanes(mNetPoint);
 }
 
 CmdBoardNetPointEdit::~CmdBoardNetPointEdit() noexcept {
@@ -85,11 +88,17 @@ bool CmdBoardNetPointEdit::performExecute() {
 }
 
 void CmdBoardNetPointEdit::performUndo() {
+  mNetPoint.getBoard().setDirty();
+  mNetPoint.getBoard().invalidatePlanes(mNetPoint);
   mNetPoint.setPosition(mOldPos);
+  mNetPoint.getBoard().invalidatePlanes(mNetPoint);
 }
 
 void CmdBoardNetPointEdit::performRedo() {
+  mNetPoint.getBoard().setDirty();
+  mNetPoint.getBoard().invalidatePlanes(mNetPoint);
   mNetPoint.setPosition(mNewPos);
+  mNetPoint.getBoard().invalidatePlanes(mNetPoint);
 }
 
 /*******************************************************************************
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardnetsegmentaddelements.h"
 
+#include "../board.h"
 #include "../items/bi_netline.h"
 #include "../items/bi_netpoint.h"
 #include "../items/bi_netsegment.h"
@@ -94,11 +95,23 @@ bool CmdBoardNetSegmentAddElements::performExecute() {
 }
 
 void CmdBoardNetSegmentAddElements::performUndo() {
+  mNetSegment.getBoard().setDirty();
+  invalidatePlanes();
   mNetSegment.removeElements(mVias, mNetPoints, mNetLines);  // can throw
 }
 
 void CmdBoardNetSegmentAddElements::performRedo() {
+  mNetSegment.getBoard().setDirty();
   mNetSegment.addElements(mVias, mNetPoints, mNetLines);  // can throw
+  invalidatePlanes();
+}
+
+void CmdBoardNetSegmentAddElements::invalidatePlanes() noexcept {
+  Board& board = mNetSegment.getBoard();
+  foreach (const BI_Via* via, mVias) { board.invalidatePlanes(*via); }
+  foreach (const BI_NetLine* netline, mNetLines) {
+    board.invalidatePlanes(*netline);
+  }
 }
 
 /*******************************************************************************
@@ -76,6 +76,8 @@ private:
   /// @copydoc UndoCommand::performRedo()
   void performRedo() override;
 
+  void invalidatePlanes() noexcept;
+
   // Private Member Variables
   BI_NetSegment& mNetSegment;
   QList<BI_Via*> mVias;
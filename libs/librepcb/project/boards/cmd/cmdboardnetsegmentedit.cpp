@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardnetsegmentedit.h"
 
+#include "../board.h"
 #include "../items/bi_netsegment.h"
 
 #include <QtCore>
@@ -67,11 +68,17 @@ bool CmdBoardNetSegmentEdit::performExecute() {
 }
 
 void CmdBoardNetSegmentEdit::performUndo() {
+  mNetSegment.getBoard().setDirty();
+  mNetSegment.getBoard().invalidatePlanes(mNetSegment);
   mNetSegment.setNetSignal(mOldNetSignal);  // can throw
+  mNetSegment.getBoard().invalidatePlanes(mNetSegment);
 }
 
 void CmdBoardNetSegmentEdit::performRedo() {
+  mNetSegment.getBoard().setDirty();
+  mNetSegment.getBoard().invalidatePlanes(mNetSegment);
   mNetSegment.setNetSignal(mNewNetSignal);  // can throw
+  mNetSegment.getBoard().invalidatePlanes(mNetSegment);
 }
 
 /*******************************************************************************
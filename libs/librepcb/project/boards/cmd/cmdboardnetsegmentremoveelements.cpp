@@ -74,13 +74,25 @@ bool CmdBoardNetSegmentRemoveElements::performExecute() {
 }
 
 void CmdBoardNetSegmentRemoveElements::performUndo() {
+  mNetSegment.getBoard().setDirty();
   mNetSegment.addElements(mVias, mNetPoints, mNetLines);  // can throw
+  invalidatePlanes();
 }
 
 void CmdBoardNetSegmentRemoveElements::performRedo() {
+  mNetSegment.getBoard().setDirty();
+  invalidatePlanes();
   mNetSegment.removeElements(mVias, mNetPoints, mNetLines);  // can throw
 }
 
+void CmdBoardNetSegmentRemoveElements::invalidatePlanes() noexcept {
+  Board& board = mNetSegment.getBoard();
+  foreach (const BI_Via* via, mVias) { board.invalidatePlanes(*via); }
+  foreach (const BI_NetLine* netline, mNetLines) {
+    board.invalidatePlanes(*netline);
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
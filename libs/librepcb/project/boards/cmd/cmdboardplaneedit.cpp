@@ -158,6 +158,7 @@ bool CmdBoardPlaneEdit::performExecute() {
 }
 
 void CmdBoardPlaneEdit::performUndo() {
+  mPlane.getBoard().setDirty();
   mPlane.setNetSignal(*mOldNetSignal);  // can throw
   mPlane.setOutline(mOldOutline);
   mPlane.setLayerName(mOldLayerName);
@@ -167,11 +168,13 @@ void CmdBoardPlaneEdit::performUndo() {
   mPlane.setPriority(mOldPriority);
   mPlane.setKeepOrphans(mOldKeepOrphans);
 
-  // rebuild all planes to see the changes
-  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildAllPlanes();
+  // rebuild affected planes to see the changes
+  invalidatePlanes();
+  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildInvalidatedPlanes();
 }
 
 void CmdBoardPlaneEdit::performRedo() {
+  mPlane.getBoard().setDirty();
   mPlane.setNetSignal(*mNewNetSignal);  // can throw
   mPlane.setOutline(mNewOutline);
   mPlane.setLayerName(mNewLayerName);
@@ -181,8 +184,15 @@ void CmdBoardPlaneEdit::performRedo() {
   mPlane.setPriority(mNewPriority);
   mPlane.setKeepOrphans(mNewKeepOrphans);
 
-  // rebuild all planes to see the changes
-  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildAllPlanes();
+  // rebuild affected planes to see the changes
+  invalidatePlanes();
+  if (mDoRebuildOnChanges) mPlane.getBoard().rebuildInvalidatedPlanes();
+}
+
+void CmdBoardPlaneEdit::invalidatePlanes() noexcept {
+  Board& board = mPlane.getBoard();
+  board.invalidatePlanes(mOldOutline.toQPainterPathPx().boundingRect());
+  board.invalidatePlanes(mNewOutline.toQPainterPathPx().boundingRect());
 }
 
 /*******************************************************************************
@@ -78,6 +78,8 @@ private:
   /// @copydoc UndoCommand::performRedo()
   void performRedo() override;
 
+  void invalidatePlanes() noexcept;
+
   // Private Member Variables
 
   // Attributes from the constructor
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardviaedit.h"
 
+#include "../board.h"
 #include "../items/bi_via.h"
 
 #include <QtCore>
@@ -47,6 +48,8 @@ CmdBoardViaEdit::CmdBoardViaEdit(BI_Via& via) noexcept
     mNewSize(mOldSize),
     mOldDrillDiameter(via.getDrillDiameter()),
     mNewDrillDiameter(mOldDrillDiameter) {
+  // the item may be modified immediately, so remember its current area
+  mVia.getBoard().invalidatePlanes(mVia);
 }
 
 CmdBoardViaEdit::~CmdBoardViaEdit() noexcept {
@@ -113,17 +116,23 @@ bool CmdBoardViaEdit::performExecute() {
 }
 
 void CmdBoardViaEdit::performUndo() {
+  mVia.getBoard().setDirty();
+  mVia.getBoard().invalidatePlanes(mVia);
   mVia.setPosition(mOldPos);
   mVia.setShape(mOldShape);
   mVia.setSize(mOldSize);
   mVia.setDrillDiameter(mOldDrillDiameter);
+  mVia.getBoard().invalidatePlanes(mVia);
 }
 
 void CmdBoardViaEdit::performRedo() {
+  mVia.getBoard().setDirty();
+  mVia.getBoard().invalidatePlanes(mVia);
   mVia.setPosition(mNewPos);
   mVia.setShape(mNewShape);
   mVia.setSize(mNewSize);
   mVia.setDrillDiameter(mNewDrillDiameter);
+  mVia.getBoard().invalidatePlanes(mVia);
 }
 
 /*******************************************************************************
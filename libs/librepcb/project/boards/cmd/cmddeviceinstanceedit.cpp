@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmddeviceinstanceedit.h"
 
+#include "../board.h"
 #include "../items/bi_device.h"
 
 #include <QtCore>
@@ -45,6 +46,8 @@ CmdDeviceInstanceEdit::CmdDeviceInstanceEdit(BI_Device& dev) noexcept
     mNewRotation(mOldRotation),
     mOldMirrored(mDevice.getIsMirrored()),
     mNewMirrored(mOldMirrored) {
+  // the item may be modified immediately, so remember its current area
+  mDevice.getBoard().invalidatePlanes(mDevice);
 }
 
 CmdDeviceInstanceEdit::~CmdDeviceInstanceEdit() noexcept {
@@ -153,15 +156,21 @@ bool CmdDeviceInstanceEdit::performExecute() {
 }
 
 void CmdDeviceInstanceEdit::performUndo() {
+  mDevice.getBoard().setDirty();
+  mDevice.getBoard().invalidatePlanes(mDevice);
   mDevice.setIsMirrored(mOldMirrored);  // can throw
   mDevice.setPosition(mOldPos);
   mDevice.setRotation(mOldRotation);
+  mDevice.getBoard().invalidatePlanes(mDevice);
 }
 
 void CmdDeviceInstanceEdit::performRedo() {
+  mDevice.getBoard().setDirty();
+  mDevice.getBoard().invalidatePlanes(mDevice);
   mDevice.setIsMirrored(mNewMirrored);  // can throw
   mDevice.setPosition(mNewPos);
   mDevice.setRotation(mNewRotation);
+  mDevice.getBoard().invalidatePlanes(mDevice);
 }
 
 /*******************************************************************************
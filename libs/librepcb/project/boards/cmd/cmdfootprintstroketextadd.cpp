@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdfootprintstroketextadd.h"
 
+#include "../board.h"
 #include "../items/bi_footprint.h"
 
 #include <QtCore>
@@ -55,10 +56,12 @@ bool CmdFootprintStrokeTextAdd::performExecute() {
 }
 
 void CmdFootprintStrokeTextAdd::performUndo() {
+  mFootprint.getBoard().setDirty();
   mFootprint.removeStrokeText(mText);  // can throw
 }
 
 void CmdFootprintStrokeTextAdd::performRedo() {
+  mFootprint.getBoard().setDirty();
   mFootprint.addStrokeText(mText);  // can throw
 }
 
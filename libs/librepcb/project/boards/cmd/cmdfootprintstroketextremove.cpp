@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdfootprintstroketextremove.h"
 
+#include "../board.h"
 #include "../items/bi_footprint.h"
 
 #include <QtCore>
@@ -57,10 +58,12 @@ bool CmdFootprintStrokeTextRemove::performExecute() {
 }
 
 void CmdFootprintStrokeTextRemove::performUndo() {
+  mFootprint.getBoard().setDirty();
   mFootprint.addStrokeText(mText);  // can throw
 }
 
 void CmdFootprintStrokeTextRemove::performRedo() {
+  mFootprint.getBoard().setDirty();
   mFootprint.removeStrokeText(mText);  // can throw
 }
 
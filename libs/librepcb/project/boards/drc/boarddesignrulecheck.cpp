@@ -47,6 +47,7 @@
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -61,10 +62,30 @@ namespace project {
 
 BoardDesignRuleCheck::BoardDesignRuleCheck(Board& board, const Options& options,
                                            QObject* parent) noexcept
-  : QObject(parent), mBoard(board), mOptions(options), mMessages() {
+  : QObject(parent),
+    mBoard(board),
+    mOptions(options),
+    mMessages(),
+    mCancelRequested(0),
+    mProcessEvents(true),
+    mRunning(false),
+    mRestartRequested(false),
+    mOutlineModified(true) {
+  // remember modifications for the next incremental run
+  connect(&mBoard, &Board::copperModified, this,
+          [this](const NetSignal* netsignal) {
+            mDirtyNetSignals.insert(netsignal);
+          });
+  connect(&mBoard, &Board::deviceModified, this,
+          [this](const BI_Device& device) { mDirtyDevices.insert(&device); });
+  connect(&mClearanceChecksWatcher, &QFutureWatcher<void>::finished, this,
+          &BoardDesignRuleCheck::clearanceChecksFinished);
 }
 
 BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept {
+  // the worker threads access members of this object
+  cancel();
+  mClearanceChecksWatcher.waitForFinished();
 }
 
 /*******************************************************************************
@@ -72,211 +93,544 @@ BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept {
  ******************************************************************************/
 
 void BoardDesignRuleCheck::execute() {
+  waitForFinished();
   emit started();
   emit progressPercent(5);
 
-  mMessages.clear();
+  mCancelRequested.store(0);
+  mProcessEvents = true;
+  clearCache();
+
+  try {
+    prepare(5, 35);
+    startClearanceChecks();
+    waitForFutures(mClearanceChecks, 35, 90);
+    finish();
+  } catch (...) {
+    // the cached state is inconsistent now
+    clearCache();
+    throw;
+  }
+}
 
-  rebuildPlanes(5, 15);
-  checkCopperBoardClearances(15, 40);
-  checkCopperCopperClearances(40, 70);
-  checkMinimumCopperWidth(70, 72);
-  checkMinimumPthRestring(72, 74);
-  checkMinimumPthDrillDiameter(74, 76);
-  checkMinimumNpthDrillDiameter(76, 78);
-  checkCourtyardClearances(78, 88);
-  checkForMissingConnections(88, 90);
-
-  emit progressStatus(
-      tr("Finished with %1 message(s)!", "Count of messages", mMessages.count())
-          .arg(mMessages.count()));
-  emit progressPercent(100);
-  emit finished();
+void BoardDesignRuleCheck::startIncremental() {
+  if (mRunning) {
+    mRestartRequested = true;
+    return;
+  }
+
+  emit started();
+  emit progressPercent(5);
+
+  mCancelRequested.store(0);
+  mProcessEvents = false;
+
+  try {
+    prepare(5, 35);
+  } catch (...) {
+    // the cached state is inconsistent now
+    clearCache();
+    throw;
+  }
+
+  // Wait for the clearance checks in another thread, to get notified by the
+  // watcher when all of them have finished. Errors are handled by finish().
+  startClearanceChecks();
+  mRunning = true;
+  QList<QFuture<QList<BoardDesignRuleCheckMessage>>> checks = mClearanceChecks;
+  mClearanceChecksWatcher.setFuture(QtConcurrent::run([checks]() {
+    foreach (QFuture<QList<BoardDesignRuleCheckMessage>> check, checks) {
+      try {
+        check.waitForFinished();
+      } catch (...) {
+      }
+    }
+  }));
+}
+
+void BoardDesignRuleCheck::waitForFinished() noexcept {
+  while (mRunning) {  // a restart might have been requested meanwhile
+    mClearanceChecksWatcher.waitForFinished();
+    clearanceChecksFinished();
+  }
+}
+
+void BoardDesignRuleCheck::cancel() noexcept {
+  mCancelRequested.store(1);
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-void BoardDesignRuleCheck::rebuildPlanes(int progressStart, int progressEnd) {
-  Q_UNUSED(progressStart);
-  emit progressStatus(tr("Rebuild planes..."));
-  mBoard.rebuildAllPlanes();
-  emit progressPercent(progressEnd);
+void BoardDesignRuleCheck::prepare(int progressStart, int progressEnd) {
+  // take over the modifications reported since the last run
+  QSet<const NetSignal*> dirtyNetSignals = mDirtyNetSignals;
+  QSet<const BI_Device*> dirtyDevices = mDirtyDevices;
+  mDirtyNetSignals.clear();
+  mDirtyDevices.clear();
+
+  // if the layers have changed, everything has to be checked again
+  QList<const GraphicsLayer*> copperLayers = getCopperLayers();
+  QList<const GraphicsLayer*> courtyardLayers = getCourtyardLayers();
+  if ((copperLayers != mCopperLayers) ||
+      (courtyardLayers != mCourtyardLayers)) {
+    clearCache();
+  }
+  mCopperLayers = copperLayers;
+  mCourtyardLayers = courtyardLayers;
+  bool previousRunAvailable = !mCachedPaths.isEmpty();
+  mLayerNames.clear();
+  foreach (const GraphicsLayer* layer, copperLayers + courtyardLayers) {
+    mLayerNames.insert(layer, layer->getNameTr());
+  }
+
+  // Take a snapshot of the nets and devices. Renamed ones are considered as
+  // modified too since the messages contain their names.
+  QHash<const NetSignal*, QString> netSignalNames;
+  mNetSignals.clear();
+  foreach (const NetSignal* netsignal,
+           mBoard.getProject().getCircuit().getNetSignals()) {
+    mNetSignals.append(netsignal);
+    netSignalNames.insert(netsignal, *netsignal->getName());
+  }
+  mNetSignals.append(nullptr);  // also check unconnected copper objects
+  netSignalNames.insert(nullptr, QString());
+  foreach (const NetSignal* netsignal, mNetSignals) {
+    auto it = mNetSignalNames.constFind(netsignal);
+    if ((it == mNetSignalNames.constEnd()) ||
+        (*it != netSignalNames[netsignal])) {
+      dirtyNetSignals.insert(netsignal);
+    }
+  }
+  mNetSignalNames = netSignalNames;
+  QHash<const BI_Device*, QString> deviceNames;
+  mDevices.clear();
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    mDevices.append(device);
+    deviceNames.insert(device, *device->getComponentInstance().getName());
+    auto it = mDeviceNames.constFind(device);
+    if ((it == mDeviceNames.constEnd()) || (*it != deviceNames[device])) {
+      dirtyDevices.insert(device);
+    }
+  }
+  mDeviceNames = deviceNames;
+
+  generateCopperPaths(dirtyNetSignals, progressStart, progressEnd);
+  generateCourtyardPaths(dirtyDevices);  // can throw
+  if (isCancelRequested()) return;
+
+  // The following checks are cheap, but access the board, so they must be
+  // finished before the board can be modified again.
+  mMissingConnectionMessages = checkForMissingConnections();
+  QList<QFuture<QList<BoardDesignRuleCheckMessage>>> boardChecks;
+  boardChecks.append(
+      QtConcurrent::run([this]() { return checkMinimumCopperWidth(); }));
+  boardChecks.append(
+      QtConcurrent::run([this]() { return checkMinimumPthRestring(); }));
+  boardChecks.append(
+      QtConcurrent::run([this]() { return checkMinimumPthDrillDiameter(); }));
+  boardChecks.append(
+      QtConcurrent::run([this]() { return checkMinimumNpthDrillDiameter(); }));
+  QList<QFuture<ClipperLib::Paths>> restrictedArea = {QtConcurrent::run(
+      [this]() { return getOutlineRestrictedArea(); })};
+
+  // Only access the results after all threads have finished, since they
+  // may throw.
+  waitForFutures(boardChecks, progressEnd, progressEnd);
+  waitForFutures(restrictedArea, progressEnd, progressEnd);
+  ClipperLib::Paths area = restrictedArea.first().result();  // can throw
+  mOutlineModified =
+      (!previousRunAvailable) || (area != mOutlineRestrictedArea);
+  mOutlineRestrictedArea = area;
+  mBoardCheckMessages.clear();
+  for (int i = 0; i < boardChecks.count(); ++i) {
+    mBoardCheckMessages.append(boardChecks[i].result());  // can throw
+  }
 }
 
-void BoardDesignRuleCheck::checkForMissingConnections(int progressStart,
-                                                      int progressEnd) {
-  Q_UNUSED(progressStart);
-  emit progressStatus(tr("Check for missing connections..."));
+void BoardDesignRuleCheck::startClearanceChecks() noexcept {
+  mClearanceChecks.clear();
+  if (isCancelRequested()) return;  // prepare() might be incomplete
+  emit progressStatus(tr("Check design rules..."));
+
+  // Each clearance check writes the messages of the checked pairs into its
+  // own element of these vectors, so no locking is needed.
+  mNewBoardClearanceMessages = QVector<PairMessages>(mCopperLayers.count());
+  mNewCopperClearanceMessages = QVector<PairMessages>(mCopperLayers.count());
+  mNewCourtyardClearanceMessages =
+      QVector<PairMessages>(mCourtyardLayers.count());
+
+  // Start all checks at once. Each check collects its own messages, which
+  // are merged in the order of the checks afterwards to get the same result
+  // regardless of the order the threads have finished.
+  for (int i = 0; i < mCopperLayers.count(); ++i) {
+    const GraphicsLayer* layer = mCopperLayers[i];
+    PairMessages* result = &mNewBoardClearanceMessages[i];
+    mClearanceChecks.append(QtConcurrent::run([this, layer, result]() {
+      return checkCopperBoardClearances(layer, *result);
+    }));
+  }
+  for (int i = 0; i < mCopperLayers.count(); ++i) {
+    const GraphicsLayer* layer = mCopperLayers[i];
+    PairMessages* result = &mNewCopperClearanceMessages[i];
+    mClearanceChecks.append(QtConcurrent::run([this, layer, result]() {
+      return checkCopperCopperClearances(layer, *result);
+    }));
+  }
+  for (int i = 0; i < mCourtyardLayers.count(); ++i) {
+    const GraphicsLayer* layer = mCourtyardLayers[i];
+    PairMessages* result = &mNewCourtyardClearanceMessages[i];
+    mClearanceChecks.append(QtConcurrent::run([this, layer, result]() {
+      return checkCourtyardClearances(layer, *result);
+    }));
+  }
+}
 
-  // No check based on copper paths implemented yet -> return existing airwires
-  // instead.
-  mBoard.forceAirWiresRebuild();
-  foreach (const BI_AirWire* airwire, mBoard.getAirWires()) {
-    QString msg = tr("Missing connection: '%1'", "Placeholder is net name")
-                      .arg(*airwire->getNetSignal().getName());
-    Path location = Path::obround(airwire->getP1(), airwire->getP2(),
-                                  PositiveLength(50000));
-    addMessage(BoardDesignRuleCheckMessage(msg, location));
+void BoardDesignRuleCheck::finish() {
+  mMessages.clear();
+  if (isCancelRequested()) {
+    // the results of the aborted checks are incomplete
+    clearCache();
+    emit progressStatus(tr("Aborted!"));
+    emit progressPercent(100);
+    emit finished();
+    return;
+  }
+
+  // Merge all messages in the same order as the checks were executed before
+  // they were running in parallel.
+  QList<QList<BoardDesignRuleCheckMessage>> results;
+  foreach (const QFuture<QList<BoardDesignRuleCheckMessage>>& check,
+           mClearanceChecks) {
+    results.append(check.result());  // can throw
+  }
+  int copperLayerCount = mCopperLayers.count();
+  for (int i = 0; i < 2 * copperLayerCount; ++i) {
+    foreach (const BoardDesignRuleCheckMessage& msg, results[i]) {
+      addMessage(msg);
+    }
+  }
+  foreach (const BoardDesignRuleCheckMessage& msg, mBoardCheckMessages) {
+    addMessage(msg);
+  }
+  for (int i = 2 * copperLayerCount; i < results.count(); ++i) {
+    foreach (const BoardDesignRuleCheckMessage& msg, results[i]) {
+      addMessage(msg);
+    }
+  }
+  foreach (const BoardDesignRuleCheckMessage& msg,
+           mMissingConnectionMessages) {
+    addMessage(msg);
   }
 
-  emit progressPercent(progressEnd);
+  // remember the results for the next incremental run
+  mBoardClearanceMessages.clear();
+  mCopperClearanceMessages.clear();
+  for (int i = 0; i < copperLayerCount; ++i) {
+    mBoardClearanceMessages.insert(mCopperLayers[i],
+                                   mNewBoardClearanceMessages[i]);
+    mCopperClearanceMessages.insert(mCopperLayers[i],
+                                    mNewCopperClearanceMessages[i]);
+  }
+  mCourtyardClearanceMessages.clear();
+  for (int i = 0; i < mCourtyardLayers.count(); ++i) {
+    mCourtyardClearanceMessages.insert(mCourtyardLayers[i],
+                                       mNewCourtyardClearanceMessages[i]);
+  }
+  mClearanceChecks.clear();
+
+  emit progressStatus(tr("Finished with %1 message(s)!", "Count of messages",
+                         mMessages.count())
+                          .arg(mMessages.count()));
+  emit progressPercent(100);
+  emit finished();
 }
 
-void BoardDesignRuleCheck::checkCopperBoardClearances(int progressStart,
-                                                      int progressEnd) {
-  emit progressStatus(tr("Check board clearances..."));
+void BoardDesignRuleCheck::clearanceChecksFinished() noexcept {
+  if ((!mRunning) || (!mClearanceChecksWatcher.isFinished())) {
+    return;  // already handled by waitForFinished()
+  }
+  mRunning = false;
+  try {
+    finish();  // can throw
+  } catch (const Exception& e) {
+    clearCache();
+    qCritical() << "Design rule check failed:" << e.getMsg();
+  }
+  if (mRestartRequested) {
+    mRestartRequested = false;
+    try {
+      startIncremental();  // can throw
+    } catch (const Exception& e) {
+      qCritical() << "Design rule check failed:" << e.getMsg();
+    }
+  }
+}
 
-  qreal progressSpan = progressEnd - progressStart;
-  QList<NetSignal*> netsignals =
-      mBoard.getProject().getCircuit().getNetSignals().values();
-  netsignals.append(nullptr);  // also check unconnected copper objects
+void BoardDesignRuleCheck::clearCache() noexcept {
+  // Without data of a previous run, everything is considered as modified
+  mCachedPaths.clear();
+  mCourtyardPaths.clear();
+  mOutlineRestrictedArea.clear();
+  mOutlineModified = true;
+  mModifiedNetSignals.clear();
+  mModifiedDevices.clear();
+  mNetSignalNames.clear();
+  mDeviceNames.clear();
+  mBoardClearanceMessages.clear();
+  mCopperClearanceMessages.clear();
+  mCourtyardClearanceMessages.clear();
+}
 
-  // Board outline
-  ClipperLib::Paths outlineRestrictedArea;
-  {
-    BoardClipperPathGenerator gen(mBoard, maxArcTolerance());
-    gen.addBoardOutline();
-    outlineRestrictedArea = gen.getPaths();
-    ClipperLib::Paths outlinePathsInner = gen.getPaths();
-    ClipperHelpers::offset(
-        outlinePathsInner,
-        *maxArcTolerance() - *mOptions.minCopperBoardClearance,
-        maxArcTolerance());
-    ClipperHelpers::subtract(outlineRestrictedArea, outlinePathsInner);
+void BoardDesignRuleCheck::generateCopperPaths(
+    const QSet<const NetSignal*>& dirtyNetSignals, int progressStart,
+    int progressEnd) {
+  if (isCancelRequested()) return;
+  emit progressStatus(tr("Generate copper areas..."));
+
+  // Generate the copper paths of modified nets only, each layer in a
+  // separate thread. Nets without paths of the previous run are generated
+  // as well.
+  QList<QFuture<CopperPaths>> futures;
+  foreach (const GraphicsLayer* layer, mCopperLayers) {
+    CopperPaths previous = mCachedPaths.value(layer);
+    QList<const NetSignal*> netsignals;
+    foreach (const NetSignal* netsignal, mNetSignals) {
+      if (dirtyNetSignals.contains(netsignal) ||
+          (!previous.contains(netsignal))) {
+        netsignals.append(netsignal);
+      }
+    }
+    futures.append(QtConcurrent::run([this, layer, netsignals]() {
+      CopperPaths paths;
+      foreach (const NetSignal* netsignal, netsignals) {
+        if (isCancelRequested()) break;
+        BoardClipperPathGenerator gen(mBoard, maxArcTolerance());
+        gen.addCopper(layer->getName(), netsignal);
+        paths.insert(netsignal, gen.getPaths());
+      }
+      return paths;
+    }));
   }
 
-  // Holes
-  {
-    BoardClipperPathGenerator gen(mBoard, maxArcTolerance());
-    gen.addHoles(*mOptions.minCopperNpthClearance - *maxArcTolerance());
-    ClipperHelpers::unite(outlineRestrictedArea, gen.getPaths());
+  // Only access the results after all threads have finished, since they
+  // may throw.
+  waitForFutures(futures, progressStart, progressEnd);
+  if (isCancelRequested()) return;
+
+  // Compare with the previous run to determine what has to be checked again.
+  // Paths of removed nets are dropped.
+  QHash<const GraphicsLayer*, CopperPaths> previousPaths = mCachedPaths;
+  mCachedPaths.clear();
+  mModifiedNetSignals.clear();
+  for (int i = 0; i < mCopperLayers.count(); ++i) {
+    const GraphicsLayer* layer = mCopperLayers[i];
+    CopperPaths generated = futures[i].result();  // can throw
+    CopperPaths previous = previousPaths.value(layer);
+    CopperPaths& paths = mCachedPaths[layer];
+    QSet<const NetSignal*>& modified = mModifiedNetSignals[layer];
+    foreach (const NetSignal* netsignal, mNetSignals) {
+      auto it = previous.constFind(netsignal);
+      if (generated.contains(netsignal)) {
+        paths.insert(netsignal, generated[netsignal]);
+        if ((it == previous.constEnd()) || (*it != generated[netsignal]) ||
+            dirtyNetSignals.contains(netsignal)) {
+          modified.insert(netsignal);
+        }
+      } else {
+        paths.insert(netsignal, *it);
+      }
+    }
   }
+}
 
-  auto layers = mBoard.getLayerStack().getAllLayers();
-  for (int layerIndex = 0; layerIndex < layers.count(); ++layerIndex) {
-    const GraphicsLayer* layer = layers[layerIndex];
-    if ((!layer->isCopperLayer()) || (!layer->isEnabled())) {
-      continue;
+void BoardDesignRuleCheck::generateCourtyardPaths(
+    const QSet<const BI_Device*>& dirtyDevices) {
+  if (isCancelRequested()) return;
+
+  // Generate the courtyards of modified devices only and compare them with
+  // the previous run. Courtyards of removed devices are dropped.
+  QHash<const GraphicsLayer*, CourtyardPaths> previousPaths = mCourtyardPaths;
+  mCourtyardPaths.clear();
+  mModifiedDevices.clear();
+  foreach (const GraphicsLayer* layer, mCourtyardLayers) {
+    CourtyardPaths previous = previousPaths.value(layer);
+    CourtyardPaths& paths = mCourtyardPaths[layer];
+    QSet<const BI_Device*>& modified = mModifiedDevices[layer];
+    foreach (const BI_Device* device, mDevices) {
+      auto it = previous.constFind(device);
+      if (dirtyDevices.contains(device) || (it == previous.constEnd())) {
+        ClipperLib::Paths courtyard = getDeviceCourtyardPaths(*device, layer);
+        ClipperHelpers::offset(courtyard, mOptions.courtyardOffset,
+                               maxArcTolerance());
+        paths.insert(device, courtyard);
+        modified.insert(device);  // it might have been renamed
+      } else {
+        paths.insert(device, *it);
+      }
     }
-    for (int i = 0; i < netsignals.count(); ++i) {
+  }
+}
+
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkForMissingConnections() const {
+  // No check based on copper paths implemented yet -> return existing airwires
+  // instead. They are kept up to date by the board editor, so they must not
+  // be rebuilt here.
+  QList<BoardDesignRuleCheckMessage> messages;
+  foreach (const BI_AirWire* airwire, mBoard.getAirWires()) {
+    QString msg = tr("Missing connection: '%1'", "Placeholder is net name")
+                      .arg(*airwire->getNetSignal().getName());
+    Path location = Path::obround(airwire->getP1(), airwire->getP2(),
+                                  PositiveLength(50000));
+    messages.append(BoardDesignRuleCheckMessage(msg, location));
+  }
+  return messages;
+}
+
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkCopperBoardClearances(
+        const GraphicsLayer* layer, PairMessages& result) const {
+  QList<BoardDesignRuleCheckMessage> messages;
+  PairMessages previous = mBoardClearanceMessages.value(layer);
+  foreach (const NetSignal* netsignal, mNetSignals) {
+    if (isCancelRequested()) break;
+    ItemPair pair(netsignal, nullptr);
+    QList<BoardDesignRuleCheckMessage> pairMessages;
+    if ((!mOutlineModified) && (!isModified(layer, netsignal))) {
+      pairMessages = previous.value(pair);
+    } else {
       std::unique_ptr<ClipperLib::PolyTree> intersections =
-          ClipperHelpers::intersect(outlineRestrictedArea,
-                                    getCopperPaths(layer, netsignals[i]));
+          ClipperHelpers::intersect(mOutlineRestrictedArea,
+                                    getCopperPaths(layer, netsignal));
       for (const ClipperLib::Path& path :
            ClipperHelpers::flattenTree(*intersections)) {
-        QString name1 = netsignals[i] ? *netsignals[i]->getName() : "";
         QString msg = tr("Clearance (%1): '%2' <-> Board Outline",
                          "Placeholders are layer name + net name")
-                          .arg(layer->getNameTr(), name1);
+                          .arg(mLayerNames[layer], mNetSignalNames[netsignal]);
         Path location = ClipperHelpers::convert(path);
-        addMessage(BoardDesignRuleCheckMessage(msg, location));
+        pairMessages.append(BoardDesignRuleCheckMessage(msg, location));
       }
-      qreal progress = progressSpan *
-          qreal((layerIndex + 1) * netsignals.count() + i + 1) /
-          qreal(layers.count() * netsignals.count());
-      emit progressPercent(progressStart + static_cast<int>(progress));
+    }
+    if (!pairMessages.isEmpty()) {
+      result.insert(pair, pairMessages);
+      messages.append(pairMessages);
     }
   }
+  return messages;
 }
 
-void BoardDesignRuleCheck::checkCopperCopperClearances(int progressStart,
-                                                       int progressEnd) {
-  emit progressStatus(tr("Check copper clearances..."));
-
-  qreal progressSpan = progressEnd - progressStart;
-  QList<NetSignal*> netsignals =
-      mBoard.getProject().getCircuit().getNetSignals().values();
-  netsignals.append(nullptr);  // also check unconnected copper objects
-
-  auto layers = mBoard.getLayerStack().getAllLayers();
-  for (int layerIndex = 0; layerIndex < layers.count(); ++layerIndex) {
-    const GraphicsLayer* layer = layers[layerIndex];
-    if ((!layer->isCopperLayer()) || (!layer->isEnabled())) {
-      continue;
-    }
-    for (int i = 0; i < netsignals.count(); ++i) {
-      ClipperLib::Paths paths1 = getCopperPaths(layer, netsignals[i]);
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkCopperCopperClearances(
+        const GraphicsLayer* layer, PairMessages& result) const {
+  QList<BoardDesignRuleCheckMessage> messages;
+  PairMessages previous = mCopperClearanceMessages.value(layer);
+
+  // Offset the copper of each net only once, and remember its bounds to
+  // skip pairs of nets which are too far away from each other. Nets are
+  // offset only when needed since in an incremental run, only few pairs
+  // have to be checked again.
+  QVector<ClipperLib::Paths> paths(mNetSignals.count());
+  QVector<ClipperLib::IntRect> bounds(mNetSignals.count());
+  QVector<bool> modified(mNetSignals.count());
+  QVector<bool> prepared(mNetSignals.count(), false);
+  for (int i = 0; i < mNetSignals.count(); ++i) {
+    modified[i] = isModified(layer, mNetSignals[i]);
+  }
+  auto prepare = [&](int i) {
+    if (prepared[i]) return;
+    paths[i] = getCopperPaths(layer, mNetSignals[i]);
+    if (!paths[i].empty()) {
       ClipperHelpers::offset(
-          paths1, (*mOptions.minCopperCopperClearance - *maxArcTolerance()) / 2,
+          paths[i],
+          (*mOptions.minCopperCopperClearance - *maxArcTolerance()) / 2,
           maxArcTolerance());
-      for (int k = i + 1; k < netsignals.count(); ++k) {
-        ClipperLib::Paths paths2 = getCopperPaths(layer, netsignals[k]);
-        ClipperHelpers::offset(
-            paths2,
-            (*mOptions.minCopperCopperClearance - *maxArcTolerance()) / 2,
-            maxArcTolerance());
+      bounds[i] = ClipperHelpers::getBounds(paths[i]);
+    }
+    prepared[i] = true;
+  };
+
+  for (int i = 0; i < mNetSignals.count(); ++i) {
+    if (isCancelRequested()) break;
+    for (int k = i + 1; k < mNetSignals.count(); ++k) {
+      ItemPair pair(mNetSignals[i], mNetSignals[k]);
+      QList<BoardDesignRuleCheckMessage> pairMessages;
+      if ((!modified[i]) && (!modified[k])) {
+        pairMessages = previous.value(pair);
+      } else {
+        prepare(i);
+        prepare(k);
+        if (paths[i].empty() || paths[k].empty() ||
+            (!ClipperHelpers::boundsIntersect(bounds[i], bounds[k]))) {
+          continue;
+        }
         std::unique_ptr<ClipperLib::PolyTree> intersections =
-            ClipperHelpers::intersect(paths1, paths2);
+            ClipperHelpers::intersect(paths[i], paths[k]);
         for (const ClipperLib::Path& path :
              ClipperHelpers::flattenTree(*intersections)) {
-          QString name1 = netsignals[i] ? *netsignals[i]->getName() : "";
-          QString name2 = netsignals[k] ? *netsignals[k]->getName() : "";
           QString msg = tr("Clearance (%1): '%2' <-> '%3'",
                            "Placeholders are layer name + net names")
-                            .arg(layer->getNameTr(), name1, name2);
+                            .arg(mLayerNames[layer],
+                                 mNetSignalNames[mNetSignals[i]],
+                                 mNetSignalNames[mNetSignals[k]]);
           Path location = ClipperHelpers::convert(path);
-          addMessage(BoardDesignRuleCheckMessage(msg, location));
+          pairMessages.append(BoardDesignRuleCheckMessage(msg, location));
         }
       }
-      qreal progress = progressSpan *
-          qreal((layerIndex + 1) * netsignals.count() + i + 1) /
-          qreal(layers.count() * netsignals.count());
-      emit progressPercent(progressStart + static_cast<int>(progress));
+      if (!pairMessages.isEmpty()) {
+        result.insert(pair, pairMessages);
+        messages.append(pairMessages);
+      }
     }
   }
+  return messages;
 }
 
-void BoardDesignRuleCheck::checkCourtyardClearances(int progressStart,
-                                                    int progressEnd) {
-  Q_UNUSED(progressStart);
-  emit progressStatus(tr("Check courtyard clearances..."));
-
-  auto layers = mBoard.getLayerStack().getLayers(
-      {GraphicsLayer::sTopCourtyard, GraphicsLayer::sBotCourtyard});
-  foreach (const GraphicsLayer* layer, layers) {
-    // determine device courtyard areas
-    QMap<const BI_Device*, ClipperLib::Paths> deviceCourtyards;
-    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-      ClipperLib::Paths paths = getDeviceCourtyardPaths(*device, layer);
-      ClipperHelpers::offset(paths, mOptions.courtyardOffset,
-                             maxArcTolerance());
-      deviceCourtyards.insert(device, paths);
-    }
-
-    // check clearances
-    for (int i = 0; i < deviceCourtyards.count(); ++i) {
-      const BI_Device* dev1 = deviceCourtyards.keys()[i];
-      Q_ASSERT(dev1);
-      const ClipperLib::Paths& paths1 = deviceCourtyards[dev1];
-      for (int k = i + 1; k < deviceCourtyards.count(); ++k) {
-        const BI_Device* dev2 = deviceCourtyards.keys()[k];
-        Q_ASSERT(dev2);
-        const ClipperLib::Paths& paths2 = deviceCourtyards[dev2];
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkCourtyardClearances(
+        const GraphicsLayer* layer, PairMessages& result) const {
+  QList<BoardDesignRuleCheckMessage> messages;
+  PairMessages previous = mCourtyardClearanceMessages.value(layer);
+  const CourtyardPaths& courtyards = *mCourtyardPaths.constFind(layer);
+  for (int i = 0; i < mDevices.count(); ++i) {
+    if (isCancelRequested()) break;
+    const BI_Device* dev1 = mDevices[i];
+    Q_ASSERT(dev1);
+    const ClipperLib::Paths& paths1 = *courtyards.constFind(dev1);
+    for (int k = i + 1; k < mDevices.count(); ++k) {
+      const BI_Device* dev2 = mDevices[k];
+      Q_ASSERT(dev2);
+      ItemPair pair(dev1, dev2);
+      QList<BoardDesignRuleCheckMessage> pairMessages;
+      if ((!isModified(layer, dev1)) && (!isModified(layer, dev2))) {
+        pairMessages = previous.value(pair);
+      } else {
+        const ClipperLib::Paths& paths2 = *courtyards.constFind(dev2);
         std::unique_ptr<ClipperLib::PolyTree> intersections =
             ClipperHelpers::intersect(paths1, paths2);
         for (const ClipperLib::Path& path :
              ClipperHelpers::flattenTree(*intersections)) {
-          QString name1 = *dev1->getComponentInstance().getName();
-          QString name2 = *dev2->getComponentInstance().getName();
           QString msg = tr("Clearance (%1): '%2' <-> '%3'",
                            "Placeholders are layer name + component names")
-                            .arg(layer->getNameTr(), name1, name2);
+                            .arg(mLayerNames[layer], mDeviceNames[dev1],
+                                 mDeviceNames[dev2]);
           Path location = ClipperHelpers::convert(path);
-          addMessage(BoardDesignRuleCheckMessage(msg, location));
+          pairMessages.append(BoardDesignRuleCheckMessage(msg, location));
         }
       }
+      if (!pairMessages.isEmpty()) {
+        result.insert(pair, pairMessages);
+        messages.append(pairMessages);
+      }
     }
   }
-
-  emit progressPercent(progressEnd);
+  return messages;
 }
 
-void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressStart,
-                                                   int progressEnd) {
-  Q_UNUSED(progressStart);
-  emit progressStatus(tr("Check minimum copper width..."));
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkMinimumCopperWidth() const {
+  QList<BoardDesignRuleCheckMessage> messages;
 
   // stroke texts
   foreach (const BI_StrokeText* text, mBoard.getStrokeTexts()) {
@@ -298,7 +652,7 @@ void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressStart,
         locations += path.toOutlineStrokes(PositiveLength(
             qMax(*text->getText().getStrokeWidth(), Length(50000))));
       }
-      addMessage(BoardDesignRuleCheckMessage(msg, locations));
+      messages.append(BoardDesignRuleCheckMessage(msg, locations));
     }
   }
 
@@ -317,7 +671,7 @@ void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressStart,
       QVector<Path> locations =
           plane->getOutline().toClosedPath().toOutlineStrokes(
               PositiveLength(200000));
-      addMessage(BoardDesignRuleCheckMessage(msg, locations));
+      messages.append(BoardDesignRuleCheckMessage(msg, locations));
     }
   }
 
@@ -344,7 +698,7 @@ void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressStart,
           locations += path.toOutlineStrokes(PositiveLength(
               qMax(*text->getText().getStrokeWidth(), Length(50000))));
         }
-        addMessage(BoardDesignRuleCheckMessage(msg, locations));
+        messages.append(BoardDesignRuleCheckMessage(msg, locations));
       }
     }
   }
@@ -364,18 +718,17 @@ void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressStart,
         Path location = Path::obround(netline->getStartPoint().getPosition(),
                                       netline->getEndPoint().getPosition(),
                                       netline->getWidth());
-        addMessage(BoardDesignRuleCheckMessage(msg, location));
+        messages.append(BoardDesignRuleCheckMessage(msg, location));
       }
     }
   }
 
-  emit progressPercent(progressEnd);
+  return messages;
 }
 
-void BoardDesignRuleCheck::checkMinimumPthRestring(int progressStart,
-                                                   int progressEnd) {
-  Q_UNUSED(progressStart);
-  emit progressStatus(tr("Check minimum PTH restrings..."));
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkMinimumPthRestring() const {
+  QList<BoardDesignRuleCheckMessage> messages;
 
   // vias
   foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
@@ -389,7 +742,7 @@ void BoardDesignRuleCheck::checkMinimumPthRestring(int progressStart,
         PositiveLength diameter = via->getDrillDiameter() +
             mOptions.minPthRestring + mOptions.minPthRestring;
         Path location = Path::circle(diameter).translated(via->getPosition());
-        addMessage(BoardDesignRuleCheckMessage(msg, location));
+        messages.append(BoardDesignRuleCheckMessage(msg, location));
       }
     }
   }
@@ -414,18 +767,17 @@ void BoardDesignRuleCheck::checkMinimumPthRestring(int progressStart,
             PositiveLength(pad->getLibPad().getDrillDiameter() + 1) +
             mOptions.minPthRestring + mOptions.minPthRestring;
         Path location = Path::circle(diameter).translated(pad->getPosition());
-        addMessage(BoardDesignRuleCheckMessage(msg, location));
+        messages.append(BoardDesignRuleCheckMessage(msg, location));
       }
     }
   }
 
-  emit progressPercent(progressEnd);
+  return messages;
 }
 
-void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressStart,
-                                                        int progressEnd) {
-  Q_UNUSED(progressStart);
-  emit progressStatus(tr("Check minimum PTH drill diameters..."));
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkMinimumPthDrillDiameter() const {
+  QList<BoardDesignRuleCheckMessage> messages;
 
   // vias
   foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
@@ -437,7 +789,7 @@ void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressStart,
                                formatLength(*via->getDrillDiameter()));
         Path location = Path::circle(via->getDrillDiameter())
                             .translated(via->getPosition());
-        addMessage(BoardDesignRuleCheckMessage(msg, location));
+        messages.append(BoardDesignRuleCheckMessage(msg, location));
       }
     }
   }
@@ -459,18 +811,17 @@ void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressStart,
         PositiveLength diameter(
             qMax(*pad->getLibPad().getDrillDiameter(), Length(50000)));
         Path location = Path::circle(diameter).translated(pad->getPosition());
-        addMessage(BoardDesignRuleCheckMessage(msg, location));
+        messages.append(BoardDesignRuleCheckMessage(msg, location));
       }
     }
   }
 
-  emit progressPercent(progressEnd);
+  return messages;
 }
 
-void BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(int progressStart,
-                                                         int progressEnd) {
-  Q_UNUSED(progressStart);
-  emit progressStatus(tr("Check minimum NPTH drill diameters..."));
+QList<BoardDesignRuleCheckMessage>
+    BoardDesignRuleCheck::checkMinimumNpthDrillDiameter() const {
+  QList<BoardDesignRuleCheckMessage> messages;
 
   QString msgTr = tr("Min. hole diameter: %1", "Placeholder is drill diameter");
 
@@ -480,7 +831,7 @@ void BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(int progressStart,
       QString msg = msgTr.arg(formatLength(*hole->getHole().getDiameter()));
       Path location = Path::circle(hole->getHole().getDiameter())
                           .translated(hole->getPosition());
-      addMessage(BoardDesignRuleCheckMessage(msg, location));
+      messages.append(BoardDesignRuleCheckMessage(msg, location));
     }
   }
 
@@ -493,26 +844,70 @@ void BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(int progressStart,
         Path location =
             Path::circle(hole.getDiameter())
                 .translated(footprint.mapToScene(hole.getPosition()));
-        addMessage(BoardDesignRuleCheckMessage(msg, location));
+        messages.append(BoardDesignRuleCheckMessage(msg, location));
       }
     }
   }
 
-  emit progressPercent(progressEnd);
+  return messages;
 }
 
-const ClipperLib::Paths& BoardDesignRuleCheck::getCopperPaths(
-    const GraphicsLayer* layer, const NetSignal* netsignal) {
-  if (!mCachedPaths[layer].contains(netsignal)) {
+QList<const GraphicsLayer*> BoardDesignRuleCheck::getCopperLayers() const
+    noexcept {
+  QList<const GraphicsLayer*> layers;
+  foreach (const GraphicsLayer* layer, mBoard.getLayerStack().getAllLayers()) {
+    if (layer->isCopperLayer() && layer->isEnabled()) {
+      layers.append(layer);
+    }
+  }
+  return layers;
+}
+
+QList<const GraphicsLayer*> BoardDesignRuleCheck::getCourtyardLayers() const
+    noexcept {
+  QList<const GraphicsLayer*> layers;
+  foreach (const GraphicsLayer* layer,
+           mBoard.getLayerStack().getLayers(
+               {GraphicsLayer::sTopCourtyard, GraphicsLayer::sBotCourtyard})) {
+    layers.append(layer);
+  }
+  return layers;
+}
+
+ClipperLib::Paths BoardDesignRuleCheck::getOutlineRestrictedArea() const {
+  // Board outline
+  ClipperLib::Paths restrictedArea;
+  {
+    BoardClipperPathGenerator gen(mBoard, maxArcTolerance());
+    gen.addBoardOutline();
+    restrictedArea = gen.getPaths();
+    ClipperLib::Paths outlinePathsInner = gen.getPaths();
+    ClipperHelpers::offset(
+        outlinePathsInner,
+        *maxArcTolerance() - *mOptions.minCopperBoardClearance,
+        maxArcTolerance());
+    ClipperHelpers::subtract(restrictedArea, outlinePathsInner);
+  }
+
+  // Holes
+  {
     BoardClipperPathGenerator gen(mBoard, maxArcTolerance());
-    gen.addCopper(layer->getName(), netsignal);
-    mCachedPaths[layer][netsignal] = gen.getPaths();
+    gen.addHoles(*mOptions.minCopperNpthClearance - *maxArcTolerance());
+    ClipperHelpers::unite(restrictedArea, gen.getPaths());
   }
-  return mCachedPaths[layer][netsignal];
+  return restrictedArea;
+}
+
+const ClipperLib::Paths& BoardDesignRuleCheck::getCopperPaths(
+    const GraphicsLayer* layer, const NetSignal* netsignal) const noexcept {
+  // all paths are generated in advance by generateCopperPaths()
+  Q_ASSERT(mCachedPaths.contains(layer));
+  Q_ASSERT(mCachedPaths.constFind(layer)->contains(netsignal));
+  return *mCachedPaths.constFind(layer)->constFind(netsignal);
 }
 
 ClipperLib::Paths BoardDesignRuleCheck::getDeviceCourtyardPaths(
-    const BI_Device& device, const GraphicsLayer* layer) {
+    const BI_Device& device, const GraphicsLayer* layer) const {
   ClipperLib::Paths paths;
   for (const Polygon& polygon : device.getLibFootprint().getPolygons()) {
     QString polygonLayer = *polygon.getLayerName();
@@ -549,6 +944,51 @@ ClipperLib::Paths BoardDesignRuleCheck::getDeviceCourtyardPaths(
   return paths;
 }
 
+template <typename T>
+void BoardDesignRuleCheck::waitForFutures(const QList<QFuture<T>>& futures,
+                                          int progressStart, int progressEnd) {
+  if (!mProcessEvents) {
+    foreach (QFuture<T> future, futures) {
+      try {
+        future.waitForFinished();
+      } catch (...) {
+        // errors are thrown when accessing the result
+      }
+    }
+    emit progressPercent(progressEnd);
+    return;
+  }
+
+  // Keep processing events while waiting, e.g. to allow cancelling the check.
+  QEventLoop loop;
+  QTimer timer;
+  connect(&timer, &QTimer::timeout, [&]() {
+    int finishedCount = 0;
+    foreach (const QFuture<T>& future, futures) {
+      if (future.isFinished()) ++finishedCount;
+    }
+    emit progressPercent(progressStart +
+                         (progressEnd - progressStart) * finishedCount /
+                             qMax(futures.count(), 1));
+    if (finishedCount == futures.count()) loop.quit();
+  });
+  timer.start(50);
+  loop.exec();
+}
+
+bool BoardDesignRuleCheck::isModified(const GraphicsLayer* layer,
+                                      const NetSignal* netsignal) const
+    noexcept {
+  auto it = mModifiedNetSignals.constFind(layer);
+  return (it == mModifiedNetSignals.constEnd()) || it->contains(netsignal);
+}
+
+bool BoardDesignRuleCheck::isModified(const GraphicsLayer* layer,
+                                      const BI_Device* device) const noexcept {
+  auto it = mModifiedDevices.constFind(layer);
+  return (it == mModifiedDevices.constEnd()) || it->contains(device);
+}
+
 void BoardDesignRuleCheck::addMessage(
     const BoardDesignRuleCheckMessage& msg) noexcept {
   mMessages.append(msg);
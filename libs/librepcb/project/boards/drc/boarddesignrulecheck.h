@@ -85,10 +85,55 @@ public:
   const QList<BoardDesignRuleCheckMessage>& getMessages() const noexcept {
     return mMessages;
   }
+  bool isCancelRequested() const noexcept {
+    return mCancelRequested.load() != 0;
+  }
+  bool isRunning() const noexcept { return mRunning; }
 
   // General Methods
+
+  /**
+   * @brief Run all checks from scratch
+   *
+   * Events are processed while waiting for the worker threads, so the caller
+   * must make sure the board is not modified in the meantime (e.g. by using
+   * a modal dialog).
+   *
+   * @note The board is checked as it is, i.e. planes and airwires are neither
+   *       rebuilt nor modified in any other way.
+   */
   void execute();
 
+  /**
+   * @brief Start checking what was modified since the last run
+   *
+   * Modifications are tracked with the signals Board::copperModified() and
+   * Board::deviceModified(). Only the copper of modified nets and the
+   * courtyards of modified devices are generated again, which happens before
+   * this method returns since it needs to access the board. Afterwards, the
+   * clearances of pairs containing a modified net or device are checked in
+   * worker threads, without accessing the board anymore. The messages of all
+   * other pairs are taken from the last run.
+   *
+   * This method returns immediately, #finished() is emitted as soon as the
+   * messages are available. If a check is still running, it will be started
+   * again after it has finished.
+   */
+  void startIncremental();
+
+  /**
+   * @brief Block until the check started by #startIncremental() has finished
+   */
+  void waitForFinished() noexcept;
+
+  /**
+   * @brief Request to abort a running check as soon as possible
+   *
+   * The check keeps processing events while waiting for its worker threads,
+   * so this can be called e.g. from a button while the check is running.
+   */
+  void cancel() noexcept;
+
 signals:
   void started();
   void progressPercent(int percent);
@@ -96,20 +141,60 @@ signals:
   void progressMessage(const QString& msg);
   void finished();
 
+private:  // Types
+  typedef QHash<const NetSignal*, ClipperLib::Paths> CopperPaths;
+  typedef QMap<const BI_Device*, ClipperLib::Paths> CourtyardPaths;
+
+  /// Pair of nets or devices checked against each other
+  typedef QPair<const void*, const void*> ItemPair;
+
+  /// Messages of a clearance check by pair, only non-empty lists are stored
+  typedef QHash<ItemPair, QList<BoardDesignRuleCheckMessage>> PairMessages;
+
 private:  // Methods
-  void rebuildPlanes(int progressStart, int progressEnd);
-  void checkForMissingConnections(int progressStart, int progressEnd);
-  void checkCopperBoardClearances(int progressStart, int progressEnd);
-  void checkCopperCopperClearances(int progressStart, int progressEnd);
-  void checkCourtyardClearances(int progressStart, int progressEnd);
-  void checkMinimumCopperWidth(int progressStart, int progressEnd);
-  void checkMinimumPthRestring(int progressStart, int progressEnd);
-  void checkMinimumPthDrillDiameter(int progressStart, int progressEnd);
-  void checkMinimumNpthDrillDiameter(int progressStart, int progressEnd);
+  void prepare(int progressStart, int progressEnd);
+  void startClearanceChecks() noexcept;
+  void finish();
+  void clearanceChecksFinished() noexcept;
+  void clearCache() noexcept;
+  void generateCopperPaths(const QSet<const NetSignal*>& dirtyNetSignals,
+                           int progressStart, int progressEnd);
+  void generateCourtyardPaths(const QSet<const BI_Device*>& dirtyDevices);
+  QList<BoardDesignRuleCheckMessage> checkForMissingConnections() const;
+
+  // The clearance checks are executed in worker threads while the board
+  // might be modified, so they must only access the data generated by
+  // prepare(). They write the messages of each checked pair into "result"
+  // for the next incremental run.
+  QList<BoardDesignRuleCheckMessage> checkCopperBoardClearances(
+      const GraphicsLayer* layer, PairMessages& result) const;
+  QList<BoardDesignRuleCheckMessage> checkCopperCopperClearances(
+      const GraphicsLayer* layer, PairMessages& result) const;
+  QList<BoardDesignRuleCheckMessage> checkCourtyardClearances(
+      const GraphicsLayer* layer, PairMessages& result) const;
+
+  // The following checks are cheap, but access the board. They are executed
+  // in worker threads while prepare() waits for them.
+  QList<BoardDesignRuleCheckMessage> checkMinimumCopperWidth() const;
+  QList<BoardDesignRuleCheckMessage> checkMinimumPthRestring() const;
+  QList<BoardDesignRuleCheckMessage> checkMinimumPthDrillDiameter() const;
+  QList<BoardDesignRuleCheckMessage> checkMinimumNpthDrillDiameter() const;
+
+  QList<const GraphicsLayer*> getCopperLayers() const noexcept;
+  QList<const GraphicsLayer*> getCourtyardLayers() const noexcept;
+  ClipperLib::Paths getOutlineRestrictedArea() const;
   const ClipperLib::Paths& getCopperPaths(const GraphicsLayer* layer,
-                                          const NetSignal* netsignal);
+                                          const NetSignal* netsignal) const
+      noexcept;
   ClipperLib::Paths getDeviceCourtyardPaths(const BI_Device& device,
-                                            const GraphicsLayer* layer);
+                                            const GraphicsLayer* layer) const;
+  template <typename T>
+  void waitForFutures(const QList<QFuture<T>>& futures, int progressStart,
+                      int progressEnd);
+  bool isModified(const GraphicsLayer* layer, const NetSignal* netsignal) const
+      noexcept;
+  bool isModified(const GraphicsLayer* layer, const BI_Device* device) const
+      noexcept;
   void addMessage(const BoardDesignRuleCheckMessage& msg) noexcept;
   QString formatLength(const Length& length) const noexcept;
 
@@ -124,8 +209,47 @@ private:  // Data
   Board& mBoard;
   Options mOptions;
   QList<BoardDesignRuleCheckMessage> mMessages;
-  QHash<const GraphicsLayer*, QHash<const NetSignal*, ClipperLib::Paths>>
-      mCachedPaths;
+  QAtomicInt mCancelRequested;
+  bool mProcessEvents;  ///< Whether to process events while waiting
+  bool mRunning;  ///< Whether clearance checks are running in the background
+  bool mRestartRequested;  ///< Whether to start again when finished
+
+  // Modifications since the last run, reported by the board
+  QSet<const NetSignal*> mDirtyNetSignals;
+  QSet<const BI_Device*> mDirtyDevices;
+
+  // State of the board at the start of the last run. The clearance checks
+  // must only access these members since they run in worker threads.
+  QList<const GraphicsLayer*> mCopperLayers;
+  QList<const GraphicsLayer*> mCourtyardLayers;
+  QHash<const GraphicsLayer*, QString> mLayerNames;
+  QList<const NetSignal*> mNetSignals;
+  QHash<const NetSignal*, QString> mNetSignalNames;
+  QList<const BI_Device*> mDevices;
+  QHash<const BI_Device*, QString> mDeviceNames;
+  ClipperLib::Paths mOutlineRestrictedArea;
+  QHash<const GraphicsLayer*, CopperPaths> mCachedPaths;
+  QHash<const GraphicsLayer*, CourtyardPaths> mCourtyardPaths;
+
+  // What has changed compared to the run before the last one
+  bool mOutlineModified;  ///< Whether the restricted area has changed
+  QHash<const GraphicsLayer*, QSet<const NetSignal*>> mModifiedNetSignals;
+  QHash<const GraphicsLayer*, QSet<const BI_Device*>> mModifiedDevices;
+
+  // Results of the checks of the last run
+  QList<BoardDesignRuleCheckMessage> mBoardCheckMessages;
+  QList<BoardDesignRuleCheckMessage> mMissingConnectionMessages;
+  QHash<const GraphicsLayer*, PairMessages> mBoardClearanceMessages;
+  QHash<const GraphicsLayer*, PairMessages> mCopperClearanceMessages;
+  QHash<const GraphicsLayer*, PairMessages> mCourtyardClearanceMessages;
+
+  // Running clearance checks. Each check writes into its own element of the
+  // vectors, so they must not be resized while the checks are running.
+  QList<QFuture<QList<BoardDesignRuleCheckMessage>>> mClearanceChecks;
+  QVector<PairMessages> mNewBoardClearanceMessages;
+  QVector<PairMessages> mNewCopperClearanceMessages;
+  QVector<PairMessages> mNewCourtyardClearanceMessages;
+  QFutureWatcher<void> mClearanceChecksWatcher;
 };
 
 /*******************************************************************************
@@ -122,10 +122,11 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
 
   // set shapes and bounding rect
   mShape = mLibPad.getOutline().toQPainterPathPx();
-  mCopper = mLibPad.toQPainterPathPx();
-  mStopMask = mLibPad.getOutline(stopMaskClearance).toQPainterPathPx();
-  mCreamMask = mLibPad.getOutline(creamMaskClearance).toQPainterPathPx();
-  mBoundingRect = mStopMask.boundingRect();
+  mCopper.setPath(mLibPad.toQPainterPathPx());
+  mStopMask.setPath(mLibPad.getOutline(stopMaskClearance).toQPainterPathPx());
+  mCreamMask.setPath(
+      mLibPad.getOutline(creamMaskClearance).toQPainterPathPx());
+  mBoundingRect = mStopMask.getBoundingRect();
 
   update();
 }
@@ -137,11 +138,8 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
 void BGI_FootprintPad::paint(QPainter* painter,
                              const QStyleOptionGraphicsItem* option,
                              QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
-  // const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) !=
-  // 0); const qreal lod =
-  // option->levelOfDetailFromTransform(painter->worldTransform());
+  const qreal lod = LevelOfDetailPath::getLevelOfDetail(*painter, *option);
 
   const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
   bool highlight =
@@ -151,40 +149,42 @@ void BGI_FootprintPad::paint(QPainter* painter,
     // draw bottom cream mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomCreamMaskLayer->getColor(highlight));
-    painter->drawPath(mCreamMask);
+    mCreamMask.draw(*painter, lod);
   }
 
   if (mBottomStopMaskLayer && mBottomStopMaskLayer->isVisible()) {
     // draw bottom stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    mStopMask.draw(*painter, lod);
   }
 
   if (mPadLayer && mPadLayer->isVisible()) {
     // draw pad
     painter->setPen(Qt::NoPen);
     painter->setBrush(mPadLayer->getColor(highlight));
-    painter->drawPath(mCopper);
-    // draw pad text
-    painter->setFont(mFont);
-    painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-    painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
-                      mPad.getDisplayText());
+    mCopper.draw(*painter, lod);
+    // draw pad text (skipped if too small to be readable)
+    if (mFont.pixelSize() * lod >= 4) {
+      painter->setFont(mFont);
+      painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+      painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
+                        mPad.getDisplayText());
+    }
   }
 
   if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
     // draw top stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    mStopMask.draw(*painter, lod);
   }
 
   if (mTopCreamMaskLayer && mTopCreamMaskLayer->isVisible()) {
     // draw top cream mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopCreamMaskLayer->getColor(highlight));
-    painter->drawPath(mCreamMask);
+    mCreamMask.draw(*painter, lod);
   }
 
 #ifdef QT_DEBUG
@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "bgi_base.h"
 
+#include <librepcb/common/graphics/levelofdetailpath.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -89,9 +91,9 @@ private:
   GraphicsLayer* mTopCreamMaskLayer;
   GraphicsLayer* mBottomCreamMaskLayer;
   QPainterPath mShape;
-  QPainterPath mCopper;
-  QPainterPath mStopMask;
-  QPainterPath mCreamMask;
+  LevelOfDetailPath mCopper;
+  LevelOfDetailPath mStopMask;
+  LevelOfDetailPath mCreamMask;
   QRectF mBoundingRect;
   QFont mFont;
 };
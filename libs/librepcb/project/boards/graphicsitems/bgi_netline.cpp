@@ -30,6 +30,8 @@
 #include "../items/bi_netpoint.h"
 #include "../items/bi_netsegment.h"
 
+#include <librepcb/common/graphics/levelofdetailpath.h>
+
 #include <QPrinter>
 #include <QtCore>
 #include <QtWidgets>
@@ -89,6 +91,9 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept {
   PositiveLength width = qMax(mNetLine.getWidth(), PositiveLength(100000));
   ps.setWidth(width->toPx());
   mShape = ps.createStroke(mShape);
+  // The shape may be wider than the line, but must be within the bounding rect
+  // since items are looked up by their bounding rect in the scene index.
+  mBoundingRect = mBoundingRect.united(mShape.boundingRect());
   update();
 }
 
@@ -99,8 +104,8 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept {
 void BGI_NetLine::paint(QPainter* painter,
                         const QStyleOptionGraphicsItem* option,
                         QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
+  const qreal lod = LevelOfDetailPath::getLevelOfDetail(*painter, *option);
 
   const NetSignal* netsignal = mNetLine.getNetSegment().getNetSignal();
   bool highlight =
@@ -108,8 +113,10 @@ void BGI_NetLine::paint(QPainter* painter,
 
   // draw line
   if (mLayer->isVisible()) {
-    QPen pen(mLayer->getColor(highlight), mNetLine.getWidth()->toPx(),
-             Qt::SolidLine, Qt::RoundCap);
+    // lines thinner than a pixel are drawn with the much faster cosmetic pen
+    qreal width = mNetLine.getWidth()->toPx();
+    if (width * lod < 1) width = 0;
+    QPen pen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap);
     painter->setPen(pen);
     painter->drawLine(mLineF);
   }
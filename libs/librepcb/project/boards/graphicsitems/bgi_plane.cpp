@@ -120,8 +120,8 @@ void BGI_Plane::updateCacheAndRepaint() noexcept {
   // get areas
   mAreas.clear();
   for (const Path& r : mPlane.getFragments()) {
-    mAreas.append(r.toQPainterPathPx());
-    mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
+    mAreas.append(LevelOfDetailPath(r.toQPainterPathPx()));
+    mBoundingRect = mBoundingRect.united(mAreas.last().getBoundingRect());
   }
 
   update();
@@ -140,6 +140,7 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
       (dynamic_cast<QPrinter*>(painter->device()) != nullptr);
   const qreal lod =
       option->levelOfDetailFromTransform(painter->worldTransform());
+  const qreal areasLod = LevelOfDetailPath::getLevelOfDetail(*painter, *option);
 
   if (mLayer && mLayer->isVisible()) {
     // draw outline only on screen, not for print or PDF export
@@ -166,7 +167,9 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     if (mPlane.isVisible()) {
       painter->setPen(Qt::NoPen);
       painter->setBrush(mLayer->getColor(selected));
-      foreach (const QPainterPath& area, mAreas) { painter->drawPath(area); }
+      foreach (const LevelOfDetailPath& area, mAreas) {
+        area.draw(*painter, areasLod);
+      }
     }
   }
 
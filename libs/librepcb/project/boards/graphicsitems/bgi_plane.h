@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "bgi_base.h"
 
+#include <librepcb/common/graphics/levelofdetailpath.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -98,7 +100,7 @@ private:
   QRectF mBoundingRect;
   QPainterPath mShape;
   QPainterPath mOutline;
-  QVector<QPainterPath> mAreas;
+  QVector<LevelOfDetailPath> mAreas;
   qreal mLineWidthPx;
   qreal mVertexRadiusPx;
 };
@@ -92,9 +92,10 @@ void BGI_Via::updateCacheAndRepaint() noexcept {
 
   // set shapes and bounding rect
   mShape = mVia.getVia().getOutline().toQPainterPathPx();
-  mCopper = mVia.getVia().toQPainterPathPx();
-  mStopMask = mVia.getVia().getOutline(*stopMaskClearance).toQPainterPathPx();
-  mBoundingRect = mStopMask.boundingRect();
+  mCopper.setPath(mVia.getVia().toQPainterPathPx());
+  mStopMask.setPath(
+      mVia.getVia().getOutline(*stopMaskClearance).toQPainterPathPx());
+  mBoundingRect = mStopMask.getBoundingRect();
 
   update();
 }
@@ -105,8 +106,8 @@ void BGI_Via::updateCacheAndRepaint() noexcept {
 
 void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                     QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
+  const qreal lod = LevelOfDetailPath::getLevelOfDetail(*painter, *option);
 
   const NetSignal* netsignal = mVia.getNetSegment().getNetSignal();
   bool highlight =
@@ -117,17 +118,17 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     // draw bottom stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    mStopMask.draw(*painter, lod);
   }
 
   if (mViaLayer && mViaLayer->isVisible()) {
     // draw via
     painter->setPen(Qt::NoPen);
     painter->setBrush(mViaLayer->getColor(highlight));
-    painter->drawPath(mCopper);
+    mCopper.draw(*painter, lod);
 
-    // draw netsignal name
-    if (netsignal) {
+    // draw netsignal name (skipped if too small to be readable)
+    if (netsignal && (mFont.pixelSize() * lod >= 4)) {
       painter->setFont(mFont);
       painter->setPen(mViaLayer->getColor(highlight).lighter(150));
       painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
@@ -139,7 +140,7 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     // draw top stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    mStopMask.draw(*painter, lod);
   }
 
 #ifdef QT_DEBUG
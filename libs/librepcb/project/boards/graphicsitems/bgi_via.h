@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "bgi_base.h"
 
+#include <librepcb/common/graphics/levelofdetailpath.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -82,9 +84,9 @@ private:
   // Cached Attributes
   bool mDrawStopMask;
   QPainterPath mShape;
-  QPainterPath mCopper;
-  QPainterPath mStopMask;
-  QPainterPath mCreamMask;
+  LevelOfDetailPath mCopper;
+  LevelOfDetailPath mStopMask;
+  LevelOfDetailPath mCreamMask;
   QRectF mBoundingRect;
   QFont mFont;
 };
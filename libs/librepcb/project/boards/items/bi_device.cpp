@@ -204,6 +204,7 @@ bool BI_Device::isUsed() const noexcept {
 void BI_Device::setPosition(const Point& pos) noexcept {
   if (pos != mPosition) {
     mPosition = pos;
+    mBoard.setDirty();
     emit moved(mPosition);
   }
 }
@@ -211,6 +212,7 @@ void BI_Device::setPosition(const Point& pos) noexcept {
 void BI_Device::setRotation(const Angle& rot) noexcept {
   if (rot != mRotation) {
     mRotation = rot;
+    mBoard.setDirty();
     emit rotated(mRotation);
   }
 }
@@ -221,6 +223,7 @@ void BI_Device::setIsMirrored(bool mirror) {
       throw LogicError(__FILE__, __LINE__);
     }
     mIsMirrored = mirror;
+    mBoard.setDirty();
     emit mirrored(mIsMirrored);
   }
 }
@@ -288,6 +288,9 @@ void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* from,
   }
   mBoard.scheduleAirWiresRebuild(from);
   mBoard.scheduleAirWiresRebuild(to);
+  emit mBoard.copperModified(from);
+  emit mBoard.copperModified(to);
+  mBoard.invalidatePlanes(getSceneOutline().toQPainterPathPx().boundingRect());
 }
 
 /*******************************************************************************
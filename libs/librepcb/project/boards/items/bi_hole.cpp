@@ -26,6 +26,7 @@
 #include "../board.h"
 #include "../boardlayerstack.h"
 
+#include <librepcb/common/geometry/path.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/holegraphicsitem.h>
 
@@ -41,24 +42,28 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_Hole::BI_Hole(Board& board, const BI_Hole& other) : BI_Base(board) {
+BI_Hole::BI_Hole(Board& board, const BI_Hole& other)
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(Uuid::createRandom(), *other.mHole));
   init();
 }
 
 BI_Hole::BI_Hole(Board& board, const SExpression& node,
                  const Version& fileFormat)
-  : BI_Base(board) {
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(node, fileFormat));
   init();
 }
 
-BI_Hole::BI_Hole(Board& board, const Hole& hole) : BI_Base(board) {
+BI_Hole::BI_Hole(Board& board, const Hole& hole)
+  : BI_Base(board), mOnHoleEditedSlot(*this, &BI_Hole::holeEdited) {
   mHole.reset(new Hole(hole));
   init();
 }
 
 void BI_Hole::init() {
+  mHole->onEdited.attach(mOnHoleEditedSlot);
+  mPlanesAreaPx = getPlanesAreaPx();
   mGraphicsItem.reset(new HoleGraphicsItem(*mHole, mBoard.getLayerStack()));
 }
 
@@ -116,6 +121,29 @@ void BI_Hole::setSelected(bool selected) noexcept {
   mGraphicsItem->setSelected(selected);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BI_Hole::holeEdited(const Hole& hole, Hole::Event event) noexcept {
+  Q_UNUSED(hole);
+  if ((event == Hole::Event::PositionChanged) ||
+      (event == Hole::Event::DiameterChanged)) {
+    // planes need to be rebuilt within the old and the new area
+    mBoard.invalidatePlanes(mPlanesAreaPx);
+    mPlanesAreaPx = getPlanesAreaPx();
+    mBoard.invalidatePlanes(mPlanesAreaPx);
+  }
+  mBoard.setDirty();
+}
+
+QRectF BI_Hole::getPlanesAreaPx() const noexcept {
+  return Path::circle(mHole->getDiameter())
+      .translated(mHole->getPosition())
+      .toQPainterPathPx()
+      .boundingRect();
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -87,10 +87,16 @@ public:
 
 private:  // Methods
   void init();
+  void holeEdited(const Hole& hole, Hole::Event event) noexcept;
+  QRectF getPlanesAreaPx() const noexcept;
 
 private:  // Data
   QScopedPointer<Hole> mHole;
   QScopedPointer<HoleGraphicsItem> mGraphicsItem;
+  QRectF mPlanesAreaPx;  ///< Area affecting planes, see #getPlanesAreaPx()
+
+  // Slots
+  Hole::OnEditedSlot mOnHoleEditedSlot;
 };
 
 /*******************************************************************************
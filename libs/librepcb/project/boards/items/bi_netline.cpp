@@ -202,12 +202,14 @@ void BI_NetLine::setLayer(GraphicsLayer& layer) {
   }
   if (mTrace.setLayer(GraphicsLayerName(layer.getName()))) {
     mLayer = &layer;
+    mBoard.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
 void BI_NetLine::setWidth(const PositiveLength& width) noexcept {
   if (mTrace.setWidth(width)) {
+    mBoard.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
@@ -91,6 +91,7 @@ TraceAnchor BI_NetPoint::toTraceAnchor() const noexcept {
 
 void BI_NetPoint::setPosition(const Point& position) noexcept {
   if (mJunction.setPosition(position)) {
+    mBoard.setDirty();
     mGraphicsItem->setPos(position.toPxQPointF());
     foreach (BI_NetLine* line, mRegisteredNetLines) { line->updateLine(); }
     if (NetSignal* netsignal = mNetSegment.getNetSignal()) {
@@ -106,8 +106,8 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node,
     }
 
     // Load all vias
-    foreach (const SExpression& node, node.getChildren("via")) {
-      BI_Via* via = new BI_Via(*this, node, fileFormat);
+    foreach (const SExpression* child, node.getChildrenByName("via")) {
+      BI_Via* via = new BI_Via(*this, *child, fileFormat);
       if (getViaByUuid(via->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -118,8 +118,8 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node,
     }
 
     // Load all netpoints
-    foreach (const SExpression& child, node.getChildren("junction")) {
-      BI_NetPoint* netpoint = new BI_NetPoint(*this, child, fileFormat);
+    foreach (const SExpression* child, node.getChildrenByName("junction")) {
+      BI_NetPoint* netpoint = new BI_NetPoint(*this, *child, fileFormat);
       if (getNetPointByUuid(netpoint->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -130,9 +130,10 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node,
     }
 
     // Load all netlines
-    foreach (const SExpression& node,
-             node.getChildren("netline") + node.getChildren("trace")) {
-      BI_NetLine* netline = new BI_NetLine(*this, node, fileFormat);
+    foreach (const SExpression* child,
+             node.getChildrenByName("netline") +
+                 node.getChildrenByName("trace")) {
+      BI_NetLine* netline = new BI_NetLine(*this, *child, fileFormat);
       if (getNetLineByUuid(netline->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -190,51 +191,6 @@ bool BI_NetSegment::isUsed() const noexcept {
           (!mNetLines.isEmpty()));
 }
 
-int BI_NetSegment::getViasAtScenePos(const Point& pos,
-                                     QList<BI_Via*>& vias) const noexcept {
-  int count = 0;
-  foreach (BI_Via* via, mVias) {
-    if (via->isSelectable() &&
-        via->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
-      vias.append(via);
-      ++count;
-    }
-  }
-  return count;
-}
-
-int BI_NetSegment::getNetPointsAtScenePos(const Point& pos,
-                                          const GraphicsLayer* layer,
-                                          QList<BI_NetPoint*>& points) const
-    noexcept {
-  int count = 0;
-  foreach (BI_NetPoint* netpoint, mNetPoints) {
-    if (netpoint->isSelectable() &&
-        netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF()) &&
-        ((!layer) || (netpoint->getLayerOfLines() == layer))) {
-      points.append(netpoint);
-      ++count;
-    }
-  }
-  return count;
-}
-
-int BI_NetSegment::getNetLinesAtScenePos(const Point& pos,
-                                         const GraphicsLayer* layer,
-                                         QList<BI_NetLine*>& lines) const
-    noexcept {
-  int count = 0;
-  foreach (BI_NetLine* netline, mNetLines) {
-    if (netline->isSelectable() &&
-        netline->getGrabAreaScenePx().contains(pos.toPxQPointF()) &&
-        ((!layer) || (&netline->getLayer() == layer))) {
-      lines.append(netline);
-      ++count;
-    }
-  }
-  return count;
-}
-
 BI_NetPoint* BI_NetSegment::getNetPointNextToScenePos(
     const Point& pos, const GraphicsLayer* layer,
     UnsignedLength& maxDistance) const noexcept {
@@ -531,16 +487,13 @@ void BI_NetSegment::selectAll() noexcept {
     netline->setSelected(netline->isSelectable());
 }
 
-void BI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept {
+void BI_NetSegment::setSelection(const QSet<const BI_Base*>& items) noexcept {
   foreach (BI_Via* via, mVias)
-    via->setSelected(via->isSelectable() &&
-                     via->getGrabAreaScenePx().intersects(rectPx));
+    via->setSelected(items.contains(via));
   foreach (BI_NetPoint* netpoint, mNetPoints)
-    netpoint->setSelected(netpoint->isSelectable() &&
-                          netpoint->getGrabAreaScenePx().intersects(rectPx));
+    netpoint->setSelected(items.contains(netpoint));
   foreach (BI_NetLine* netline, mNetLines)
-    netline->setSelected(netline->isSelectable() &&
-                         netline->getGrabAreaScenePx().intersects(rectPx));
+    netline->setSelected(items.contains(netline));
 }
 
 void BI_NetSegment::clearSelection() const noexcept {
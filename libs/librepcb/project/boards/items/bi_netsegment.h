@@ -93,12 +93,6 @@ public:
   QString getNetNameToDisplay(bool fallback = false) const noexcept;
 
   bool isUsed() const noexcept;
-  int getViasAtScenePos(const Point& pos, QList<BI_Via*>& vias) const noexcept;
-  int getNetPointsAtScenePos(const Point& pos, const GraphicsLayer* layer,
-                             QList<BI_NetPoint*>& points) const noexcept;
-  int getNetLinesAtScenePos(const Point& pos, const GraphicsLayer* layer,
-                            QList<BI_NetLine*>& lines) const noexcept;
-
   BI_NetPoint* getNetPointNextToScenePos(const Point& pos,
                                          const GraphicsLayer* layer,
                                          UnsignedLength& maxDistance) const
@@ -135,7 +129,7 @@ public:
   void addToBoard() override;
   void removeFromBoard() override;
   void selectAll() noexcept;
-  void setSelectionRect(const QRectF rectPx) noexcept;
+  void setSelection(const QSet<const BI_Base*>& items) noexcept;
   void clearSelection() const noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
@@ -56,9 +56,9 @@ BI_Plane::BI_Plane(Board& board, const BI_Plane& other)
     // mThermalGapWidth(other.mThermalGapWidth),
     // mThermalSpokeWidth(other.mThermalSpokeWidth),
     mIsVisible(true),
-    mFragments(other.mFragments)  // also copy fragments to avoid the need for
-                                  // a rebuild
-{
+    mFragments(other.mFragments),  // also copy fragments to avoid the need
+                                   // for a rebuild
+    mFragmentsIndex(other.mFragmentsIndex) {
   init();
 }
 
@@ -110,7 +110,8 @@ BI_Plane::BI_Plane(Board& board, const Uuid& uuid,
     mConnectStyle(ConnectStyle::Solid),
     // mThermalGapWidth(100000), mThermalSpokeWidth(100000),
     mIsVisible(true),
-    mFragments() {
+    mFragments(),
+    mFragmentsIndex() {
   init();
 }
 
@@ -135,6 +136,7 @@ BI_Plane::~BI_Plane() noexcept {
 void BI_Plane::setOutline(const Path& outline) noexcept {
   if (outline != mOutline) {
     mOutline = outline;
+    mBoard.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
@@ -142,6 +144,7 @@ void BI_Plane::setOutline(const Path& outline) noexcept {
 void BI_Plane::setLayerName(const GraphicsLayerName& layerName) noexcept {
   if (layerName != mLayerName) {
     mLayerName = layerName;
+    mBoard.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
@@ -157,37 +160,46 @@ void BI_Plane::setNetSignal(NetSignal& netsignal) {
       netsignal.registerBoardPlane(*this);  // can throw
       sg.dismiss();
     }
+    // the fragments now belong to the new net signal
+    emit mBoard.copperModified(mNetSignal);
     mNetSignal = &netsignal;
+    mBoard.setDirty();
+    emit mBoard.copperModified(mNetSignal);
   }
 }
 
 void BI_Plane::setMinWidth(const UnsignedLength& minWidth) noexcept {
   if (minWidth != mMinWidth) {
     mMinWidth = minWidth;
+    mBoard.setDirty();
   }
 }
 
 void BI_Plane::setMinClearance(const UnsignedLength& minClearance) noexcept {
   if (minClearance != mMinClearance) {
     mMinClearance = minClearance;
+    mBoard.setDirty();
   }
 }
 
 void BI_Plane::setConnectStyle(BI_Plane::ConnectStyle style) noexcept {
   if (style != mConnectStyle) {
     mConnectStyle = style;
+    mBoard.setDirty();
   }
 }
 
 void BI_Plane::setPriority(int priority) noexcept {
   if (priority != mPriority) {
     mPriority = priority;
+    mBoard.setDirty();
   }
 }
 
 void BI_Plane::setKeepOrphans(bool keepOrphans) noexcept {
   if (keepOrphans != mKeepOrphans) {
     mKeepOrphans = keepOrphans;
+    mBoard.setDirty();
   }
 }
 
@@ -223,14 +235,21 @@ void BI_Plane::removeFromBoard() {
 
 void BI_Plane::clear() noexcept {
   mFragments.clear();
+  mFragmentsIndex = PolygonIndex();
   mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Plane::rebuild() noexcept {
   BoardPlaneFragmentsBuilder builder(*this);
-  mFragments = builder.buildFragments();
+  setFragments(builder.buildFragments());
+}
+
+void BI_Plane::setFragments(const QVector<Path>& fragments) noexcept {
+  mFragments = fragments;
+  mFragmentsIndex = PolygonIndex(mFragments);
   mGraphicsItem->updateCacheAndRepaint();
   mBoard.scheduleAirWiresRebuild(mNetSignal);
+  emit mBoard.copperModified(mNetSignal);
 }
 
 void BI_Plane::serialize(SExpression& root) const {
@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include "bi_base.h"
 
+#include <librepcb/common/algorithm/polygonindex.h>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/geometry/path.h>
 #include <librepcb/common/graphics/graphicslayername.h>
@@ -86,6 +87,9 @@ public:
   // {return mThermalSpokeWidth;}
   const Path& getOutline() const noexcept { return mOutline; }
   const QVector<Path>& getFragments() const noexcept { return mFragments; }
+  const PolygonIndex& getFragmentsIndex() const noexcept {
+    return mFragmentsIndex;
+  }
   BGI_Plane& getGraphicsItem() noexcept { return *mGraphicsItem; }
   bool isSelectable() const noexcept override;
   bool isVisible() const noexcept { return mIsVisible; }
@@ -106,6 +110,7 @@ public:
   void removeFromBoard() override;
   void clear() noexcept;
   void rebuild() noexcept;
+  void setFragments(const QVector<Path>& fragments) noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -148,6 +153,7 @@ private:  // Data
   bool mIsVisible;  // volatile, not saved to file
 
   QVector<Path> mFragments;
+  PolygonIndex mFragmentsIndex;  ///< lookup of fragments, e.g. for airwires
 };
 
 /*******************************************************************************
@@ -27,6 +27,7 @@
 #include "../boardlayerstack.h"
 
 #include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/polygongraphicsitem.h>
 
@@ -42,19 +43,24 @@ namespace project {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BI_Polygon::BI_Polygon(Board& board, const BI_Polygon& other) : BI_Base(board) {
+BI_Polygon::BI_Polygon(Board& board, const BI_Polygon& other)
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(Uuid::createRandom(), *other.mPolygon));
   init();
 }
 
 BI_Polygon::BI_Polygon(Board& board, const SExpression& node,
                        const Version& fileFormat)
-  : BI_Base(board) {
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(node, fileFormat));
   init();
 }
 
-BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon) : BI_Base(board) {
+BI_Polygon::BI_Polygon(Board& board, const Polygon& polygon)
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(new Polygon(polygon));
   init();
 }
@@ -63,13 +69,17 @@ BI_Polygon::BI_Polygon(Board& board, const Uuid& uuid,
                        const GraphicsLayerName& layerName,
                        const UnsignedLength& lineWidth, bool fill,
                        bool isGrabArea, const Path& path)
-  : BI_Base(board) {
+  : BI_Base(board),
+    mOnPolygonEditedSlot(*this, &BI_Polygon::polygonEdited) {
   mPolygon.reset(
       new Polygon(uuid, layerName, lineWidth, fill, isGrabArea, path));
   init();
 }
 
 void BI_Polygon::init() {
+  mPolygon->onEdited.attach(mOnPolygonEditedSlot);
+  mPlanesAreaPx = getPlanesAreaPx();
+
   mGraphicsItem.reset(
       new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
   mGraphicsItem->setZValue(Board::ZValue_Default);
@@ -137,6 +147,33 @@ void BI_Polygon::boardAttributesChanged() {
   mGraphicsItem->update();
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BI_Polygon::polygonEdited(const Polygon& polygon,
+                               Polygon::Event event) noexcept {
+  Q_UNUSED(polygon);
+  if ((event == Polygon::Event::LayerNameChanged) ||
+      (event == Polygon::Event::PathChanged)) {
+    // planes need to be rebuilt within the old and the new area
+    mBoard.invalidatePlanes(mPlanesAreaPx);
+    mPlanesAreaPx = getPlanesAreaPx();
+    mBoard.invalidatePlanes(mPlanesAreaPx);
+  }
+  emit mBoard.copperModified(nullptr);  // polygons have no net signal
+  mBoard.setDirty();
+}
+
+QRectF BI_Polygon::getPlanesAreaPx() const noexcept {
+  // only the board outline is taken into account by planes
+  if (mPolygon->getLayerName() == GraphicsLayer::sBoardOutlines) {
+    return mPolygon->getPath().toQPainterPathPx().boundingRect();
+  } else {
+    return QRectF();
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -27,6 +27,7 @@
 
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/graphics/graphicslayername.h>
+#include <librepcb/common/geometry/polygon.h>
 #include <librepcb/common/uuid.h>
 
 #include <QtCore>
@@ -37,7 +38,6 @@
 namespace librepcb {
 
 class Path;
-class Polygon;
 class PolygonGraphicsItem;
 
 namespace project {
@@ -102,10 +102,16 @@ private slots:
 
 private:
   void init();
+  void polygonEdited(const Polygon& polygon, Polygon::Event event) noexcept;
+  QRectF getPlanesAreaPx() const noexcept;
 
   // General
   QScopedPointer<Polygon> mPolygon;
   QScopedPointer<PolygonGraphicsItem> mGraphicsItem;
+  QRectF mPlanesAreaPx;  ///< Area affecting planes, see #getPlanesAreaPx()
+
+  // Slots
+  Polygon::OnEditedSlot mOnPolygonEditedSlot;
 };
 
 /*******************************************************************************
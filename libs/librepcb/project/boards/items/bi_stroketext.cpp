@@ -202,6 +202,10 @@ void BI_StrokeText::strokeTextEdited(const StrokeText& text,
     default:
       break;
   }
+  emit mBoard.copperModified(nullptr);  // texts have no net signal
+  if (event != StrokeText::Event::PathsChanged) {
+    mBoard.setDirty();  // paths are not serialized, everything else is
+  }
 }
 
 /*******************************************************************************
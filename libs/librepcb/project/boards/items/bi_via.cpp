@@ -90,6 +90,7 @@ TraceAnchor BI_Via::toTraceAnchor() const noexcept {
 
 void BI_Via::setPosition(const Point& position) noexcept {
   if (mVia.setPosition(position)) {
+    mBoard.setDirty();
     mGraphicsItem->setPos(position.toPxQPointF());
     foreach (BI_NetLine* netline, mRegisteredNetLines) {
       netline->updateLine();
@@ -102,18 +103,21 @@ void BI_Via::setPosition(const Point& position) noexcept {
 
 void BI_Via::setShape(Via::Shape shape) noexcept {
   if (mVia.setShape(shape)) {
+    mBoard.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
 void BI_Via::setSize(const PositiveLength& size) noexcept {
   if (mVia.setSize(size)) {
+    mBoard.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
 
 void BI_Via::setDrillDiameter(const PositiveLength& diameter) noexcept {
   if (mVia.setDrillDiameter(diameter)) {
+    mBoard.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
@@ -46,7 +46,8 @@ namespace project {
 Circuit::Circuit(Project& project, const Version& fileFormat, bool create)
   : QObject(&project),
     mProject(project),
-    mDirectory(new TransactionalDirectory(project.getDirectory(), "circuit")) {
+    mDirectory(new TransactionalDirectory(project.getDirectory(), "circuit")),
+    mIsDirty(true) {
   qDebug() << "load circuit...";
 
   try {
@@ -168,6 +169,7 @@ void Circuit::addNetClass(NetClass& netclass) {
   // add netclass to circuit
   netclass.addToCircuit();  // can throw
   mNetClasses.insert(netclass.getUuid(), &netclass);
+  mIsDirty = true;
   emit netClassAdded(netclass);
 }
 
@@ -179,6 +181,7 @@ void Circuit::removeNetClass(NetClass& netclass) {
   // remove netclass from project
   netclass.removeFromCircuit();  // can throw
   mNetClasses.remove(netclass.getUuid());
+  mIsDirty = true;
   emit netClassRemoved(netclass);
 }
 
@@ -195,6 +198,7 @@ void Circuit::setNetClassName(NetClass& netclass, const ElementName& newName) {
   }
   // apply the new name
   netclass.setName(newName);  // can throw
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -255,6 +259,7 @@ void Circuit::addNetSignal(NetSignal& netsignal) {
   // add netsignal to circuit
   netsignal.addToCircuit();  // can throw
   mNetSignals.insert(netsignal.getUuid(), &netsignal);
+  mIsDirty = true;
   emit netSignalAdded(netsignal);
 }
 
@@ -266,6 +271,7 @@ void Circuit::removeNetSignal(NetSignal& netsignal) {
   // remove netsignal from circuit
   netsignal.removeFromCircuit();  // can throw
   mNetSignals.remove(netsignal.getUuid());
+  mIsDirty = true;
   emit netSignalRemoved(netsignal);
 }
 
@@ -284,6 +290,7 @@ void Circuit::setNetSignalName(NetSignal& netsignal,
   }
   // apply the new name
   netsignal.setName(newName, isAutoName);  // can throw
+  mIsDirty = true;
 }
 
 void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept {
@@ -340,6 +347,7 @@ void Circuit::addComponentInstance(ComponentInstance& cmp) {
   // add to circuit
   cmp.addToCircuit();  // can throw
   mComponentInstances.insert(cmp.getUuid(), &cmp);
+  mIsDirty = true;
   emit componentAdded(cmp);
 }
 
@@ -351,6 +359,7 @@ void Circuit::removeComponentInstance(ComponentInstance& cmp) {
   // remove from circuit
   cmp.removeFromCircuit();  // can throw
   mComponentInstances.remove(cmp.getUuid());
+  mIsDirty = true;
   emit componentRemoved(cmp);
 }
 
@@ -368,6 +377,7 @@ void Circuit::setComponentInstanceName(ComponentInstance& cmp,
   }
   // apply the new name
   cmp.setName(newName);  // can throw
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -375,8 +385,11 @@ void Circuit::setComponentInstanceName(ComponentInstance& cmp,
  ******************************************************************************/
 
 void Circuit::save() {
-  SExpression doc(serializeToDomElement("librepcb_circuit"));  // can throw
-  mDirectory->write("circuit.lp", doc.toByteArray());  // can throw
+  if (mIsDirty) {
+    SExpression doc(serializeToDomElement("librepcb_circuit"));  // can throw
+    mDirectory->write("circuit.lp", doc.toByteArray());  // can throw
+    mIsDirty = false;
+  }
 }
 
 /*******************************************************************************
@@ -82,6 +82,15 @@ public:
 
   // Getters
   Project& getProject() const noexcept { return mProject; }
+  bool isDirty() const noexcept { return mIsDirty; }  ///< see Board::isDirty()
+
+  // Setters
+
+  /**
+   * @brief Mark the circuit as modified, i.e. it needs to be serialized on the
+   *        next #save() (see Board::setDirty())
+   */
+  void setDirty() noexcept { mIsDirty = true; }
 
   // NetClass Methods
   const QMap<Uuid, NetClass*>& getNetClasses() const noexcept {
@@ -146,6 +155,7 @@ private:
   // General
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   QScopedPointer<TransactionalDirectory> mDirectory;
+  bool mIsDirty;  ///< see #isDirty()
 
   QMap<Uuid, NetClass*> mNetClasses;
   QMap<Uuid, NetSignal*> mNetSignals;
@@ -96,6 +96,7 @@ bool CmdComponentInstanceEdit::performExecute() {
 }
 
 void CmdComponentInstanceEdit::performUndo() {
+  mCircuit.setDirty();
   mCircuit.setComponentInstanceName(mComponentInstance, mOldName);  // can throw
   mComponentInstance.setValue(mOldValue);
   mComponentInstance.setAttributes(mOldAttributes);
@@ -103,6 +104,7 @@ void CmdComponentInstanceEdit::performUndo() {
 }
 
 void CmdComponentInstanceEdit::performRedo() {
+  mCircuit.setDirty();
   mCircuit.setComponentInstanceName(mComponentInstance, mNewName);  // can throw
   mComponentInstance.setValue(mNewValue);
   mComponentInstance.setAttributes(mNewAttributes);
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdcompsiginstsetnetsignal.h"
 
+#include "../circuit.h"
 #include "../componentsignalinstance.h"
 
 #include <QtCore>
@@ -58,10 +59,12 @@ bool CmdCompSigInstSetNetSignal::performExecute() {
 }
 
 void CmdCompSigInstSetNetSignal::performUndo() {
+  mComponentSignalInstance.getCircuit().setDirty();
   mComponentSignalInstance.setNetSignal(mOldNetSignal);  // can throw
 }
 
 void CmdCompSigInstSetNetSignal::performRedo() {
+  mComponentSignalInstance.getCircuit().setDirty();
   mComponentSignalInstance.setNetSignal(mNetSignal);  // can throw
 }
 
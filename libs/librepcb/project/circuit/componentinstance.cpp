@@ -226,6 +226,7 @@ bool ComponentInstance::isUsed() const noexcept {
 void ComponentInstance::setName(const CircuitIdentifier& name) noexcept {
   if (name != mName) {
     mName = name;
+    mCircuit.setDirty();
     updateErcMessages();
     emit attributesChanged();
   }
@@ -234,6 +235,7 @@ void ComponentInstance::setName(const CircuitIdentifier& name) noexcept {
 void ComponentInstance::setValue(const QString& value) noexcept {
   if (value != mValue) {
     mValue = value;
+    mCircuit.setDirty();
     emit attributesChanged();
   }
 }
@@ -242,6 +244,7 @@ void ComponentInstance::setAttributes(
     const AttributeList& attributes) noexcept {
   if (attributes != *mAttributes) {
     *mAttributes = attributes;
+    mCircuit.setDirty();
     emit attributesChanged();
   }
 }
@@ -250,6 +253,7 @@ void ComponentInstance::setDefaultDeviceUuid(
     const tl::optional<Uuid>& device) noexcept {
   if (device != mDefaultDeviceUuid) {
     mDefaultDeviceUuid = device;
+    mCircuit.setDirty();
     emit attributesChanged();
   }
 }
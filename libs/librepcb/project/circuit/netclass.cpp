@@ -71,6 +71,7 @@ void NetClass::setName(const ElementName& name) noexcept {
     return;
   }
   mName = name;
+  mCircuit.setDirty();
   updateErcMessages();
 }
 
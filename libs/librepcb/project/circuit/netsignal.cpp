@@ -123,6 +123,7 @@ void NetSignal::setName(const CircuitIdentifier& name,
   }
   mName = name;
   mHasAutoName = isAutoName;
+  mCircuit.setDirty();
   updateErcMessages();
   emit nameChanged(mName);
 }
@@ -382,6 +382,10 @@ public:
   /**
    * @brief Save the project to the transactional file system
    *
+   * Schematics, boards and the circuit are only serialized if they were
+   * modified since the last call (see Board::isDirty()), so periodic
+   * autosaves of large projects are cheap.
+   *
    * @throw Exception     If an error occurred.
    */
   void save();
@@ -8,7 +8,7 @@ TARGET = librepcbproject
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 isEmpty(UNBUNDLE) {
     CONFIG += staticlib
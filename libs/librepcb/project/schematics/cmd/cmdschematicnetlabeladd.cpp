@@ -64,10 +64,12 @@ bool CmdSchematicNetLabelAdd::performExecute() {
 }
 
 void CmdSchematicNetLabelAdd::performUndo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.removeNetLabel(*mNetLabel);  // can throw
 }
 
 void CmdSchematicNetLabelAdd::performRedo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.addNetLabel(*mNetLabel);  // can throw
 }
 
@@ -23,6 +23,7 @@
 #include "cmdschematicnetlabeledit.h"
 
 #include "../items/si_netlabel.h"
+#include "../schematic.h"
 
 #include <QtCore>
 
@@ -101,11 +102,13 @@ bool CmdSchematicNetLabelEdit::performExecute() {
 }
 
 void CmdSchematicNetLabelEdit::performUndo() {
+  mNetLabel.getSchematic().setDirty();
   mNetLabel.setPosition(mOldPos);
   mNetLabel.setRotation(mOldRotation);
 }
 
 void CmdSchematicNetLabelEdit::performRedo() {
+  mNetLabel.getSchematic().setDirty();
   mNetLabel.setPosition(mNewPos);
   mNetLabel.setRotation(mNewRotation);
 }
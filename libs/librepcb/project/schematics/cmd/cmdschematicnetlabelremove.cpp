@@ -59,10 +59,12 @@ bool CmdSchematicNetLabelRemove::performExecute() {
 }
 
 void CmdSchematicNetLabelRemove::performUndo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.addNetLabel(mNetLabel);  // can throw
 }
 
 void CmdSchematicNetLabelRemove::performRedo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.removeNetLabel(mNetLabel);  // can throw
 }
 
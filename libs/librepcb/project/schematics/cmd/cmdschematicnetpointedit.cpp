@@ -23,6 +23,7 @@
 #include "cmdschematicnetpointedit.h"
 
 #include "../items/si_netpoint.h"
+#include "../schematic.h"
 
 #include <QtCore>
 
@@ -78,10 +79,12 @@ bool CmdSchematicNetPointEdit::performExecute() {
 }
 
 void CmdSchematicNetPointEdit::performUndo() {
+  mNetPoint.getSchematic().setDirty();
   mNetPoint.setPosition(mOldPos);
 }
 
 void CmdSchematicNetPointEdit::performRedo() {
+  mNetPoint.getSchematic().setDirty();
   mNetPoint.setPosition(mNewPos);
 }
 
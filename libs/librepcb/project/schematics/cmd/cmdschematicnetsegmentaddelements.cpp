@@ -25,6 +25,7 @@
 #include "../items/si_netline.h"
 #include "../items/si_netpoint.h"
 #include "../items/si_netsegment.h"
+#include "../schematic.h"
 
 #include <QtCore>
 
@@ -86,10 +87,12 @@ bool CmdSchematicNetSegmentAddElements::performExecute() {
 }
 
 void CmdSchematicNetSegmentAddElements::performUndo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.removeNetPointsAndNetLines(mNetPoints, mNetLines);  // can throw
 }
 
 void CmdSchematicNetSegmentAddElements::performRedo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.addNetPointsAndNetLines(mNetPoints, mNetLines);  // can throw
 }
 
@@ -23,6 +23,7 @@
 #include "cmdschematicnetsegmentedit.h"
 
 #include "../items/si_netsegment.h"
+#include "../schematic.h"
 
 #include <QtCore>
 
@@ -67,10 +68,12 @@ bool CmdSchematicNetSegmentEdit::performExecute() {
 }
 
 void CmdSchematicNetSegmentEdit::performUndo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.setNetSignal(*mOldNetSignal);  // can throw
 }
 
 void CmdSchematicNetSegmentEdit::performRedo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.setNetSignal(*mNewNetSignal);  // can throw
 }
 
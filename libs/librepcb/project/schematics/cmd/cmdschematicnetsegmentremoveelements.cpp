@@ -72,10 +72,12 @@ bool CmdSchematicNetSegmentRemoveElements::performExecute() {
 }
 
 void CmdSchematicNetSegmentRemoveElements::performUndo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.addNetPointsAndNetLines(mNetPoints, mNetLines);  // can throw
 }
 
 void CmdSchematicNetSegmentRemoveElements::performRedo() {
+  mNetSegment.getSchematic().setDirty();
   mNetSegment.removeNetPointsAndNetLines(mNetPoints, mNetLines);  // can throw
 }
 
@@ -23,6 +23,7 @@
 #include "cmdsymbolinstanceedit.h"
 
 #include "../items/si_symbol.h"
+#include "../schematic.h"
 
 #include <QtCore>
 
@@ -148,12 +149,14 @@ bool CmdSymbolInstanceEdit::performExecute() {
 }
 
 void CmdSymbolInstanceEdit::performUndo() {
+  mSymbol.getSchematic().setDirty();
   mSymbol.setPosition(mOldPos);
   mSymbol.setRotation(mOldRotation);
   mSymbol.setMirrored(mOldMirrored);
 }
 
 void CmdSymbolInstanceEdit::performRedo() {
+  mSymbol.getSchematic().setDirty();
   mSymbol.setPosition(mNewPos);
   mSymbol.setRotation(mNewRotation);
   mSymbol.setMirrored(mNewMirrored);
@@ -80,6 +80,9 @@ void SGI_NetLine::updateCacheAndRepaint() noexcept {
   UnsignedLength width = qMax(mNetLine.getWidth(), UnsignedLength(1270000));
   ps.setWidth(width->toPx());
   mShape = ps.createStroke(mShape);
+  // The shape may be wider than the line, but must be within the bounding rect
+  // since items are looked up by their bounding rect in the scene index.
+  mBoundingRect = mBoundingRect.united(mShape.boundingRect());
   update();
 }
 
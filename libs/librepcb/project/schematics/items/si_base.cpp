@@ -79,6 +79,7 @@ void SI_Base::addToSchematic(QGraphicsItem* item) noexcept {
   Q_ASSERT(!mIsAddedToSchematic);
   if (item) {
     mSchematic.getGraphicsScene().addItem(*item);
+    mSchematic.registerGraphicsItem(*item, *this);
   }
   mIsAddedToSchematic = true;
 }
@@ -86,6 +87,7 @@ void SI_Base::addToSchematic(QGraphicsItem* item) noexcept {
 void SI_Base::removeFromSchematic(QGraphicsItem* item) noexcept {
   Q_ASSERT(mIsAddedToSchematic);
   if (item) {
+    mSchematic.unregisterGraphicsItem(*item);
     mSchematic.getGraphicsScene().removeItem(*item);
   }
   mIsAddedToSchematic = false;
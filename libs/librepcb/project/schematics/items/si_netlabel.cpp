@@ -88,6 +88,7 @@ Length SI_NetLabel::getApproximateWidth() noexcept {
 
 void SI_NetLabel::setPosition(const Point& position) noexcept {
   if (mNetLabel.setPosition(position)) {
+    mSchematic.setDirty();
     mGraphicsItem->setPos(position.toPxQPointF());
     updateAnchor();
   }
@@ -95,6 +96,7 @@ void SI_NetLabel::setPosition(const Point& position) noexcept {
 
 void SI_NetLabel::setRotation(const Angle& rotation) noexcept {
   if (mNetLabel.setRotation(rotation)) {
+    mSchematic.setDirty();
     mGraphicsItem->setRotation(-rotation.toDeg());
     mGraphicsItem->updateCacheAndRepaint();
     updateAnchor();
@@ -112,6 +112,7 @@ NetSignal& SI_NetLine::getNetSignalOfNetSegment() const noexcept {
 
 void SI_NetLine::setWidth(const UnsignedLength& width) noexcept {
   if (mNetLine.setWidth(width)) {
+    mSchematic.setDirty();
     mGraphicsItem->updateCacheAndRepaint();
   }
 }
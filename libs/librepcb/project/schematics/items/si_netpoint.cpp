@@ -97,6 +97,7 @@ NetLineAnchor SI_NetPoint::toNetLineAnchor() const noexcept {
 
 void SI_NetPoint::setPosition(const Point& position) noexcept {
   if (mJunction.setPosition(position)) {
+    mSchematic.setDirty();
     mGraphicsItem->setPos(position.toPxQPointF());
     foreach (SI_NetLine* line, mRegisteredNetLines) { line->updateLine(); }
   }
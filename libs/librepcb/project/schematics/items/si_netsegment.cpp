@@ -64,8 +64,8 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node,
     }
 
     // Load all netpoints
-    foreach (const SExpression& child, node.getChildren("junction")) {
-      SI_NetPoint* netpoint = new SI_NetPoint(*this, child, fileFormat);
+    foreach (const SExpression* child, node.getChildrenByName("junction")) {
+      SI_NetPoint* netpoint = new SI_NetPoint(*this, *child, fileFormat);
       if (getNetPointByUuid(netpoint->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -76,9 +76,10 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node,
     }
 
     // Load all netlines
-    foreach (const SExpression& child,
-             node.getChildren("netline") + node.getChildren("line")) {
-      SI_NetLine* netline = new SI_NetLine(*this, child, fileFormat);
+    foreach (const SExpression* child,
+             node.getChildrenByName("netline") +
+                 node.getChildrenByName("line")) {
+      SI_NetLine* netline = new SI_NetLine(*this, *child, fileFormat);
       if (getNetLineByUuid(netline->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -89,9 +90,10 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node,
     }
 
     // Load all netlabels
-    foreach (const SExpression& child,
-             node.getChildren("netlabel") + node.getChildren("label")) {
-      SI_NetLabel* netlabel = new SI_NetLabel(*this, child, fileFormat);
+    foreach (const SExpression* child,
+             node.getChildrenByName("netlabel") +
+                 node.getChildrenByName("label")) {
+      SI_NetLabel* netlabel = new SI_NetLabel(*this, *child, fileFormat);
       if (getNetLabelByUuid(netlabel->getUuid())) {
         throw RuntimeError(
             __FILE__, __LINE__,
@@ -144,45 +146,6 @@ bool SI_NetSegment::isUsed() const noexcept {
           (!mNetLabels.isEmpty()));
 }
 
-int SI_NetSegment::getNetPointsAtScenePos(const Point& pos,
-                                          QList<SI_NetPoint*>& points) const
-    noexcept {
-  int count = 0;
-  foreach (SI_NetPoint* netpoint, mNetPoints) {
-    if (netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
-      points.append(netpoint);
-      ++count;
-    }
-  }
-  return count;
-}
-
-int SI_NetSegment::getNetLinesAtScenePos(const Point& pos,
-                                         QList<SI_NetLine*>& lines) const
-    noexcept {
-  int count = 0;
-  foreach (SI_NetLine* netline, mNetLines) {
-    if (netline->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
-      lines.append(netline);
-      ++count;
-    }
-  }
-  return count;
-}
-
-int SI_NetSegment::getNetLabelsAtScenePos(const Point& pos,
-                                          QList<SI_NetLabel*>& labels) const
-    noexcept {
-  int count = 0;
-  foreach (SI_NetLabel* netlabel, mNetLabels) {
-    if (netlabel->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
-      labels.append(netlabel);
-      ++count;
-    }
-  }
-  return count;
-}
-
 QSet<QString> SI_NetSegment::getForcedNetNames() const noexcept {
   QSet<QString> names;
   foreach (SI_NetLine* netline, mNetLines) {
@@ -500,13 +463,13 @@ void SI_NetSegment::selectAll() noexcept {
     netlabel->setSelected(true);
 }
 
-void SI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept {
+void SI_NetSegment::setSelection(const QSet<const SI_Base*>& items) noexcept {
   foreach (SI_NetPoint* netpoint, mNetPoints)
-    netpoint->setSelected(netpoint->getGrabAreaScenePx().intersects(rectPx));
+    netpoint->setSelected(items.contains(netpoint));
   foreach (SI_NetLine* netline, mNetLines)
-    netline->setSelected(netline->getGrabAreaScenePx().intersects(rectPx));
+    netline->setSelected(items.contains(netline));
   foreach (SI_NetLabel* netlabel, mNetLabels)
-    netlabel->setSelected(netlabel->getGrabAreaScenePx().intersects(rectPx));
+    netlabel->setSelected(items.contains(netlabel));
 }
 
 void SI_NetSegment::clearSelection() const noexcept {
@@ -68,12 +68,6 @@ public:
   const Uuid& getUuid() const noexcept { return mUuid; }
   NetSignal& getNetSignal() const noexcept { return *mNetSignal; }
   bool isUsed() const noexcept;
-  int getNetPointsAtScenePos(const Point& pos,
-                             QList<SI_NetPoint*>& points) const noexcept;
-  int getNetLinesAtScenePos(const Point& pos, QList<SI_NetLine*>& lines) const
-      noexcept;
-  int getNetLabelsAtScenePos(const Point& pos,
-                             QList<SI_NetLabel*>& labels) const noexcept;
   QSet<QString> getForcedNetNames() const noexcept;
   QString getForcedNetName() const noexcept;
   Point calcNearestPoint(const Point& p) const noexcept;
@@ -111,7 +105,7 @@ public:
   void addToSchematic() override;
   void removeFromSchematic() override;
   void selectAll() noexcept;
-  void setSelectionRect(const QRectF rectPx) noexcept;
+  void setSelection(const QSet<const SI_Base*>& items) noexcept;
   void clearSelection() const noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
@@ -43,16 +43,22 @@ namespace project {
 
 SI_Polygon::SI_Polygon(Schematic& schematic, const SExpression& node,
                        const Version& fileFormat)
-  : SI_Base(schematic), mPolygon(new Polygon(node, fileFormat)) {
+  : SI_Base(schematic),
+    mPolygon(new Polygon(node, fileFormat)),
+    mOnPolygonEditedSlot(*this, &SI_Polygon::polygonEdited) {
   init();
 }
 
 SI_Polygon::SI_Polygon(Schematic& schematic, const Polygon& polygon)
-  : SI_Base(schematic), mPolygon(new Polygon(polygon)) {
+  : SI_Base(schematic),
+    mPolygon(new Polygon(polygon)),
+    mOnPolygonEditedSlot(*this, &SI_Polygon::polygonEdited) {
   init();
 }
 
 void SI_Polygon::init() {
+  mPolygon->onEdited.attach(mOnPolygonEditedSlot);
+
   // Create the graphics item.
   mGraphicsItem.reset(
       new PolygonGraphicsItem(*mPolygon, mSchematic.getProject().getLayers()));
@@ -107,6 +113,17 @@ void SI_Polygon::setSelected(bool selected) noexcept {
   mGraphicsItem->setSelected(selected);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void SI_Polygon::polygonEdited(const Polygon& polygon,
+                               Polygon::Event event) noexcept {
+  Q_UNUSED(polygon);
+  Q_UNUSED(event);
+  mSchematic.setDirty();
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include "si_base.h"
 
+#include <librepcb/common/geometry/polygon.h>
 #include <librepcb/common/uuid.h>
 
 #include <QtCore>
@@ -34,7 +35,6 @@
  ******************************************************************************/
 namespace librepcb {
 
-class Polygon;
 class PolygonGraphicsItem;
 
 namespace project {
@@ -87,10 +87,14 @@ public:
 
 private:  // Methods
   void init();
+  void polygonEdited(const Polygon& polygon, Polygon::Event event) noexcept;
 
 private:  // Attributes
   QScopedPointer<Polygon> mPolygon;
   QScopedPointer<PolygonGraphicsItem> mGraphicsItem;
+
+  // Slots
+  Polygon::OnEditedSlot mOnPolygonEditedSlot;
 };
 
 /*******************************************************************************
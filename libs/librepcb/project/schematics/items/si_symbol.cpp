@@ -157,6 +157,7 @@ QRectF SI_Symbol::getBoundingRect() const noexcept {
 void SI_Symbol::setPosition(const Point& newPos) noexcept {
   if (newPos != mPosition) {
     mPosition = newPos;
+    mSchematic.setDirty();
     mGraphicsItem->setPos(newPos.toPxQPointF());
     mGraphicsItem->updateCacheAndRepaint();
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(); }
@@ -166,6 +167,7 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept {
 void SI_Symbol::setRotation(const Angle& newRotation) noexcept {
   if (newRotation != mRotation) {
     mRotation = newRotation;
+    mSchematic.setDirty();
     updateGraphicsItemTransform();
     mGraphicsItem->updateCacheAndRepaint();
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(); }
@@ -175,6 +177,7 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept {
 void SI_Symbol::setMirrored(bool newMirrored) noexcept {
   if (newMirrored != mMirrored) {
     mMirrored = newMirrored;
+    mSchematic.setDirty();
     updateGraphicsItemTransform();
     mGraphicsItem->updateCacheAndRepaint();
     foreach (SI_SymbolPin* pin, mPins) { pin->updatePosition(); }
@@ -43,16 +43,22 @@ namespace project {
 
 SI_Text::SI_Text(Schematic& schematic, const SExpression& node,
                  const Version& fileFormat)
-  : SI_Base(schematic), mText(node, fileFormat) {
+  : SI_Base(schematic),
+    mText(node, fileFormat),
+    mOnTextEditedSlot(*this, &SI_Text::textEdited) {
   init();
 }
 
 SI_Text::SI_Text(Schematic& schematic, const Text& text)
-  : SI_Base(schematic), mText(text) {
+  : SI_Base(schematic),
+    mText(text),
+    mOnTextEditedSlot(*this, &SI_Text::textEdited) {
   init();
 }
 
 void SI_Text::init() {
+  mText.onEdited.attach(mOnTextEditedSlot);
+
   // Create the graphics item.
   mGraphicsItem.reset(
       new TextGraphicsItem(mText, mSchematic.getProject().getLayers()));
@@ -112,6 +118,12 @@ void SI_Text::schematicAttributesChanged() noexcept {
   mGraphicsItem->updateText();
 }
 
+void SI_Text::textEdited(const Text& text, Text::Event event) noexcept {
+  Q_UNUSED(text);
+  Q_UNUSED(event);
+  mSchematic.setDirty();
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -62,6 +62,7 @@ Schematic::Schematic(Project& project,
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mIsDirty(true),
     mUuid(Uuid::createRandom()),
     mName("New Page") {
   try {
@@ -194,96 +195,74 @@ bool Schematic::isEmpty() const noexcept {
 
 QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept {
   QPointF scenePosPx = pos.toPxQPointF();
+  QList<SI_Base*> candidates;
+  foreach (SI_Base* item,
+           getIndexedItems(mGraphicsScene->items(
+               scenePosPx, Qt::IntersectsItemBoundingRect))) {
+    if (item->getGrabAreaScenePx().contains(scenePosPx)) {
+      candidates.append(item);
+    }
+  }
+  auto appendItems = [&](QList<SI_Base*>& list, SI_Base::Type_t type) {
+    foreach (SI_Base* item, candidates) {
+      if (item->getType() == type) list.append(item);
+    }
+  };
   QList<SI_Base*>
       list;  // Note: The order of adding the items is very important (the
              // top most item must appear as the first item in the list)!
 
   // visible netpoints
-  const QList<SI_NetPoint*> netpoints(getNetPointsAtScenePos(pos));
-  foreach (SI_NetPoint* netpoint, netpoints) {
-    if (netpoint->isVisibleJunction()) {
-      list.append(netpoint);
+  foreach (SI_Base* item, candidates) {
+    if ((item->getType() == SI_Base::Type_t::NetPoint) &&
+        static_cast<SI_NetPoint*>(item)->isVisibleJunction()) {
+      list.append(item);
     }
   }
   // hidden netpoints
-  foreach (SI_NetPoint* netpoint, netpoints) {
-    if (!netpoint->isVisibleJunction()) {
-      list.append(netpoint);
+  foreach (SI_Base* item, candidates) {
+    if ((item->getType() == SI_Base::Type_t::NetPoint) &&
+        (!static_cast<SI_NetPoint*>(item)->isVisibleJunction())) {
+      list.append(item);
     }
   }
   // netlines
-  foreach (SI_NetLine* netline, getNetLinesAtScenePos(pos)) {
-    list.append(netline);
-  }
+  appendItems(list, SI_Base::Type_t::NetLine);
   // netlabels
-  foreach (SI_NetLabel* netlabel, getNetLabelsAtScenePos(pos)) {
-    list.append(netlabel);
-  }
-  // symbols & pins
-  foreach (SI_Symbol* symbol, mSymbols) {
-    foreach (SI_SymbolPin* pin, symbol->getPins()) {
-      if (pin->getGrabAreaScenePx().contains(scenePosPx)) list.append(pin);
-    }
-    if (symbol->getGrabAreaScenePx().contains(scenePosPx)) list.append(symbol);
-  }
+  appendItems(list, SI_Base::Type_t::NetLabel);
+  // pins & symbols
+  appendItems(list, SI_Base::Type_t::SymbolPin);
+  appendItems(list, SI_Base::Type_t::Symbol);
   // polygons
-  foreach (SI_Polygon* polygon, mPolygons) {
-    if (polygon->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(polygon);
-    }
-  }
+  appendItems(list, SI_Base::Type_t::Polygon);
   // texts
-  foreach (SI_Text* text, getTextsAtScenePos(pos)) { list.append(text); }
+  appendItems(list, SI_Base::Type_t::Text);
   return list;
 }
 
 QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_NetPoint*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetPointsAtScenePos(pos, list);
-  }
-  return list;
+  return getItemsOfTypeAtScenePos<SI_NetPoint>(pos, SI_Base::Type_t::NetPoint);
 }
 
 QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_NetLine*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetLinesAtScenePos(pos, list);
-  }
-  return list;
+  return getItemsOfTypeAtScenePos<SI_NetLine>(pos, SI_Base::Type_t::NetLine);
 }
 
 QList<SI_NetLabel*> Schematic::getNetLabelsAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_NetLabel*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetLabelsAtScenePos(pos, list);
-  }
-  return list;
+  return getItemsOfTypeAtScenePos<SI_NetLabel>(pos, SI_Base::Type_t::NetLabel);
 }
 
 QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_SymbolPin*> list;
-  foreach (SI_Symbol* symbol, mSymbols) {
-    foreach (SI_SymbolPin* pin, symbol->getPins()) {
-      if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-        list.append(pin);
-    }
-  }
-  return list;
+  return getItemsOfTypeAtScenePos<SI_SymbolPin>(pos,
+                                                SI_Base::Type_t::SymbolPin);
 }
 
 QList<SI_Text*> Schematic::getTextsAtScenePos(const Point& pos) const noexcept {
-  QList<SI_Text*> list;
-  foreach (SI_Text* text, mTexts) {
-    if (text->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
-      list.append(text);
-    }
-  }
-  return list;
+  return getItemsOfTypeAtScenePos<SI_Text>(pos, SI_Base::Type_t::Text);
 }
 
 /*******************************************************************************
@@ -292,10 +271,12 @@ QList<SI_Text*> Schematic::getTextsAtScenePos(const Point& pos) const noexcept {
 
 void Schematic::setGridProperties(const GridProperties& grid) noexcept {
   *mGridProperties = grid;
+  mIsDirty = true;
 }
 
 void Schematic::setName(const ElementName& name) noexcept {
   mName = name;
+  mIsDirty = true;
   emit mProject.attributesChanged();
 }
 
@@ -325,6 +306,7 @@ void Schematic::addSymbol(SI_Symbol& symbol) {
   // add to schematic
   symbol.addToSchematic();  // can throw
   mSymbols.append(&symbol);
+  mIsDirty = true;
 }
 
 void Schematic::removeSymbol(SI_Symbol& symbol) {
@@ -334,6 +316,7 @@ void Schematic::removeSymbol(SI_Symbol& symbol) {
   // remove from schematic
   symbol.removeFromSchematic();  // can throw
   mSymbols.removeOne(&symbol);
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -362,6 +345,7 @@ void Schematic::addNetSegment(SI_NetSegment& netsegment) {
   // add to schematic
   netsegment.addToSchematic();  // can throw
   mNetSegments.append(&netsegment);
+  mIsDirty = true;
 }
 
 void Schematic::removeNetSegment(SI_NetSegment& netsegment) {
@@ -371,6 +355,7 @@ void Schematic::removeNetSegment(SI_NetSegment& netsegment) {
   // remove from schematic
   netsegment.removeFromSchematic();  // can throw
   mNetSegments.removeOne(&netsegment);
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -399,6 +384,7 @@ void Schematic::addPolygon(SI_Polygon& polygon) {
   // add to schematic
   polygon.addToSchematic();  // can throw
   mPolygons.append(&polygon);
+  mIsDirty = true;
 }
 
 void Schematic::removePolygon(SI_Polygon& polygon) {
@@ -408,6 +394,7 @@ void Schematic::removePolygon(SI_Polygon& polygon) {
   // remove from schematic
   polygon.removeFromSchematic();  // can throw
   mPolygons.removeOne(&polygon);
+  mIsDirty = true;
 }
 
 /*******************************************************************************
@@ -435,6 +422,7 @@ void Schematic::addText(SI_Text& text) {
   // add to schematic
   text.addToSchematic();  // can throw
   mTexts.append(&text);
+  mIsDirty = true;
 }
 
 void Schematic::removeText(SI_Text& text) {
@@ -444,6 +432,23 @@ void Schematic::removeText(SI_Text& text) {
   // remove from schematic
   text.removeFromSchematic();  // can throw
   mTexts.removeOne(&text);
+  mIsDirty = true;
+}
+
+/*******************************************************************************
+ *  Spatial Index Methods
+ ******************************************************************************/
+
+void Schematic::registerGraphicsItem(const QGraphicsItem& graphicsItem,
+                                     SI_Base& item) noexcept {
+  Q_ASSERT(!mItemsByGraphicsItem.contains(&graphicsItem));
+  mItemsByGraphicsItem.insert(&graphicsItem, &item);
+}
+
+void Schematic::unregisterGraphicsItem(
+    const QGraphicsItem& graphicsItem) noexcept {
+  Q_ASSERT(mItemsByGraphicsItem.contains(&graphicsItem));
+  mItemsByGraphicsItem.remove(&graphicsItem);
 }
 
 /*******************************************************************************
@@ -475,6 +480,7 @@ void Schematic::addToProject() {
   }
 
   mIsAddedToProject = true;
+  mIsDirty = true;  // the schematic directory might have been removed
   updateIcon();
   sgl.dismiss();
 }
@@ -504,10 +510,14 @@ void Schematic::removeFromProject() {
   }
 
   mIsAddedToProject = false;
+  mIsDirty = true;
   sgl.dismiss();
 }
 
 void Schematic::save() {
+  if (!mIsDirty) {
+    return;  // not modified since the last save
+  }
   if (mIsAddedToProject) {
     // save schematic file
     SExpression doc(serializeToDomElement("librepcb_schematic"));  // can throw
@@ -516,6 +526,7 @@ void Schematic::save() {
   } else {
     mDirectory->removeDirRecursively();  // can throw
   }
+  mIsDirty = false;
 }
 
 void Schematic::showInView(GraphicsView& view) noexcept {
@@ -534,25 +545,28 @@ void Schematic::setSelectionRect(const Point& p1, const Point& p2,
   mGraphicsScene->setSelectionRect(p1, p2);
   if (updateItems) {
     QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+    QSet<const SI_Base*> items;
+    foreach (SI_Base* item,
+             getIndexedItems(mGraphicsScene->items(
+                 rectPx, Qt::IntersectsItemBoundingRect))) {
+      if (item->getGrabAreaScenePx().intersects(rectPx)) {
+        items.insert(item);
+      }
+    }
     foreach (SI_Symbol* symbol, mSymbols) {
-      bool selectSymbol = symbol->getGrabAreaScenePx().intersects(rectPx);
+      bool selectSymbol = items.contains(symbol);
       symbol->setSelected(selectSymbol);
       foreach (SI_SymbolPin* pin, symbol->getPins()) {
-        bool selectPin = pin->getGrabAreaScenePx().intersects(rectPx);
-        pin->setSelected(selectSymbol || selectPin);
+        pin->setSelected(selectSymbol || items.contains(pin));
       }
     }
     foreach (SI_NetSegment* segment, mNetSegments) {
-      segment->setSelectionRect(rectPx);
+      segment->setSelection(items);
     }
     foreach (SI_Polygon* polygon, mPolygons) {
-      bool select = polygon->getGrabAreaScenePx().intersects(rectPx);
-      polygon->setSelected(select);
-    }
-    foreach (SI_Text* text, mTexts) {
-      bool selectText = text->getGrabAreaScenePx().intersects(rectPx);
-      text->setSelected(selectText);
+      polygon->setSelected(items.contains(polygon));
     }
+    foreach (SI_Text* text, mTexts) { text->setSelected(items.contains(text)); }
   }
 }
 
@@ -622,6 +636,35 @@ void Schematic::serialize(SExpression& root) const {
   serializePointerContainerUuidSorted(root, mTexts, "text");
 }
 
+template <typename T>
+QList<T*> Schematic::getItemsOfTypeAtScenePos(const Point& pos,
+                                              SI_Base::Type_t type) const
+    noexcept {
+  QPointF scenePosPx = pos.toPxQPointF();
+  QList<T*> list;
+  foreach (SI_Base* item,
+           getIndexedItems(mGraphicsScene->items(
+               scenePosPx, Qt::IntersectsItemBoundingRect))) {
+    if (item->getType() != type) continue;
+    T* typedItem = static_cast<T*>(item);
+    if (typedItem->getGrabAreaScenePx().contains(scenePosPx)) {
+      list.append(typedItem);
+    }
+  }
+  return list;
+}
+
+QList<SI_Base*> Schematic::getIndexedItems(
+    const QList<QGraphicsItem*>& graphicsItems) const noexcept {
+  QList<SI_Base*> items;
+  foreach (const QGraphicsItem* graphicsItem, graphicsItems) {
+    // child items (e.g. texts of symbols) are not registered
+    SI_Base* item = mItemsByGraphicsItem.value(graphicsItem, nullptr);
+    if (item) items.append(item);
+  }
+  return items;
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
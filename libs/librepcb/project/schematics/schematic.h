@@ -23,6 +23,8 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "items/si_base.h"
+
 #include <librepcb/common/attributes/attributeprovider.h>
 #include <librepcb/common/elementname.h>
 #include <librepcb/common/exceptions.h>
@@ -51,7 +53,6 @@ namespace project {
 class Project;
 class NetSignal;
 class ComponentInstance;
-class SI_Base;
 class SI_Symbol;
 class SI_SymbolPin;
 class SI_NetSegment;
@@ -129,6 +130,7 @@ public:
   }
   GraphicsScene& getGraphicsScene() const noexcept { return *mGraphicsScene; }
   bool isEmpty() const noexcept;
+  bool isDirty() const noexcept { return mIsDirty; }  ///< see Board::isDirty()
   QList<SI_Base*> getItemsAtScenePos(const Point& pos) const noexcept;
   QList<SI_NetPoint*> getNetPointsAtScenePos(const Point& pos) const noexcept;
   QList<SI_NetLine*> getNetLinesAtScenePos(const Point& pos) const noexcept;
@@ -139,6 +141,12 @@ public:
   // Setters: General
   void setGridProperties(const GridProperties& grid) noexcept;
 
+  /**
+   * @brief Mark the schematic as modified, i.e. it needs to be serialized on
+   *        the next #save() (see Board::setDirty())
+   */
+  void setDirty() noexcept { mIsDirty = true; }
+
   // Getters: Attributes
   const Uuid& getUuid() const noexcept { return mUuid; }
   const ElementName& getName() const noexcept { return mName; }
@@ -171,6 +179,20 @@ public:
   void addText(SI_Text& text);
   void removeText(SI_Text& text);
 
+  // Spatial Index Methods
+
+  /**
+   * @brief Register the graphics item of a schematic item in the spatial index
+   *
+   * See ::librepcb::project::Board::registerGraphicsItem() for details.
+   *
+   * @param graphicsItem  The graphics item, already added to the scene.
+   * @param item          The schematic item represented by the graphics item.
+   */
+  void registerGraphicsItem(const QGraphicsItem& graphicsItem,
+                            SI_Base& item) noexcept;
+  void unregisterGraphicsItem(const QGraphicsItem& graphicsItem) noexcept;
+
   // General Methods
   void addToProject();
   void removeFromProject();
@@ -213,6 +235,11 @@ private:
   Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory,
             const Version& fileFormat, bool create, const QString& newName);
   void updateIcon() noexcept;
+  template <typename T>
+  QList<T*> getItemsOfTypeAtScenePos(const Point& pos,
+                                     SI_Base::Type_t type) const noexcept;
+  QList<SI_Base*> getIndexedItems(
+      const QList<QGraphicsItem*>& graphicsItems) const noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -221,10 +248,12 @@ private:
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   std::unique_ptr<TransactionalDirectory> mDirectory;
   bool mIsAddedToProject;
+  bool mIsDirty;  ///< see #isDirty()
 
   QScopedPointer<GraphicsScene> mGraphicsScene;
   QScopedPointer<GridProperties> mGridProperties;
   QRectF mViewRect;
+  QHash<const QGraphicsItem*, SI_Base*> mItemsByGraphicsItem;
 
   // Attributes
   Uuid mUuid;
@@ -44,7 +44,10 @@ BoardDesignRuleCheckDialog::BoardDesignRuleCheckDialog(
     Board& board, const BoardDesignRuleCheck::Options& options,
     const LengthUnit& lengthUnit, const QString& settingsPrefix,
     QWidget* parent) noexcept
-  : QDialog(parent), mBoard(board), mUi(new Ui::BoardDesignRuleCheckDialog) {
+  : QDialog(parent),
+    mBoard(board),
+    mUi(new Ui::BoardDesignRuleCheckDialog),
+    mRunningDrc(nullptr) {
   mUi->setupUi(this);
   mUi->edtClearanceCopperCopper->configure(
       lengthUnit, LengthEditBase::Steps::generic(),
@@ -110,8 +113,16 @@ BoardDesignRuleCheck::Options BoardDesignRuleCheckDialog::getOptions() const
  ******************************************************************************/
 
 void BoardDesignRuleCheckDialog::btnRunDrcClicked() noexcept {
+  // while running, the button is used to cancel the DRC
+  if (mRunningDrc) {
+    mRunningDrc->cancel();
+    mUi->btnRun->setEnabled(false);
+    return;
+  }
+
+  QString runButtonText = mUi->btnRun->text();
   mUi->grpOptions->setEnabled(false);
-  mUi->btnRun->setEnabled(false);
+  mUi->btnRun->setText(tr("Cancel"));
   mUi->buttonBox->setEnabled(false);
 
   try {
@@ -135,13 +146,22 @@ void BoardDesignRuleCheckDialog::btnRunDrcClicked() noexcept {
     connect(&drc, SIGNAL(progressStatus(QString)), mUi->lstMessages,
             SLOT(repaint()));
 
+    // the DRC checks the board as it is, so make sure the planes are up to date
+    mBoard.rebuildAllPlanes();
+
+    mRunningDrc = &drc;
     drc.execute();  // can throw
-    mMessages = drc.getMessages();
+    mRunningDrc = nullptr;
+    if (!drc.isCancelRequested()) {
+      mMessages = drc.getMessages();
+    }
   } catch (Exception& e) {
+    mRunningDrc = nullptr;
     QMessageBox::warning(this, tr("Error"), e.getMsg());
   }
 
   mUi->grpOptions->setEnabled(true);
+  mUi->btnRun->setText(runButtonText);
   mUi->btnRun->setEnabled(true);
   mUi->buttonBox->setEnabled(true);
 }
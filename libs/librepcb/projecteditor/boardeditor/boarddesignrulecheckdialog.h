@@ -77,6 +77,7 @@ private:  // GUI Event Handlers
 private:
   Board& mBoard;
   QScopedPointer<Ui::BoardDesignRuleCheckDialog> mUi;
+  BoardDesignRuleCheck* mRunningDrc;  ///< Only valid while the DRC is running
   tl::optional<QList<BoardDesignRuleCheckMessage>> mMessages;
 };
 
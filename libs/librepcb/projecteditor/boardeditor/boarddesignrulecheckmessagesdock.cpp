@@ -49,6 +49,8 @@ BoardDesignRuleCheckMessagesDock::BoardDesignRuleCheckMessagesDock(
   connect(
       mUi->listWidget, &QListWidget::itemDoubleClicked, this,
       &BoardDesignRuleCheckMessagesDock::listWidgetCurrentItemDoubleClicked);
+  connect(mUi->cbxLiveCheck, &QCheckBox::toggled, this,
+          &BoardDesignRuleCheckMessagesDock::liveCheckToggled);
 }
 
 BoardDesignRuleCheckMessagesDock::~BoardDesignRuleCheckMessagesDock() noexcept {
@@ -58,6 +60,10 @@ BoardDesignRuleCheckMessagesDock::~BoardDesignRuleCheckMessagesDock() noexcept {
  *  Public Methods
  ******************************************************************************/
 
+bool BoardDesignRuleCheckMessagesDock::isLiveCheckEnabled() const noexcept {
+  return mUi->cbxLiveCheck->isChecked();
+}
+
 void BoardDesignRuleCheckMessagesDock::setMessages(
     const QList<BoardDesignRuleCheckMessage>& messages) noexcept {
   mMessages = messages;
@@ -56,6 +56,9 @@ public:
       const BoardDesignRuleCheckMessagesDock& other) = delete;
   ~BoardDesignRuleCheckMessagesDock() noexcept;
 
+  // Getters
+  bool isLiveCheckEnabled() const noexcept;
+
   // Setters
   void setMessages(const QList<BoardDesignRuleCheckMessage>& messages) noexcept;
 
@@ -65,6 +68,7 @@ public:
 
 signals:
   void messageSelected(const BoardDesignRuleCheckMessage& msg, bool zoomTo);
+  void liveCheckToggled(bool enabled);
 
 private:  // Methods
   void listWidgetCurrentItemChanged() noexcept;
@@ -191,6 +191,23 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   tabifyDockWidget(mErcMsgDock, mDrcMessagesDock.data());
   mUnplacedComponentsDock->raise();
 
+  // run the DRC automatically when editing pauses, if enabled in the dock
+  mLiveDrcTimer.setSingleShot(true);
+  mLiveDrcTimer.setInterval(1000);
+  connect(&mLiveDrcTimer, &QTimer::timeout, this, &BoardEditor::runLiveDrc);
+  connect(&mProjectEditor.getUndoStack(), &UndoStack::stateModified, this,
+          &BoardEditor::scheduleLiveDrc);
+  connect(mDrcMessagesDock.data(),
+          &BoardDesignRuleCheckMessagesDock::liveCheckToggled, this,
+          [this](bool enabled) {
+            if (enabled) {
+              runLiveDrc();
+            } else {
+              mLiveDrcTimer.stop();
+              mLiveDrc.reset();
+            }
+          });
+
   // Add actions to toggle visibility of dock widgets
   mUi->menuView->addSeparator();
   mUi->menuView->addAction(mUnplacedComponentsDock->toggleViewAction());
@@ -293,6 +310,8 @@ BoardEditor::~BoardEditor() {
   mUnplacedComponentsDock = nullptr;
   delete mErcMsgDock;
   mErcMsgDock = nullptr;
+  mLiveDrcTimer.stop();
+  mLiveDrc.reset();
   mDrcMessagesDock.reset();
   delete mGraphicsView;
   mGraphicsView = nullptr;
@@ -323,6 +342,7 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept {
       mActiveBoard->saveViewSceneRect(mGraphicsView->getVisibleSceneRect());
     }
     mActiveBoard = newBoard;
+    mLiveDrc.reset();  // the live DRC is bound to the board
     if (mActiveBoard) {
       // show scene, restore view scene rect, set grid properties
       mActiveBoard->showInView(*mGraphicsView);
@@ -347,6 +367,9 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept {
 
     // update toolbars
     mUi->actionGrid->setEnabled(mActiveBoard != nullptr);
+
+    // check the new board immediately
+    scheduleLiveDrc();
   }
 
   // update GUI
@@ -714,11 +737,16 @@ void BoardEditor::on_actionDesignRuleCheck_triggered() {
   Board* board = getActiveBoard();
   if (!board) return;
 
+  // the board can't be modified while the dialog is open, so there's nothing
+  // to check for the live DRC in the meantime
+  mLiveDrcTimer.stop();
+
   BoardDesignRuleCheckDialog dialog(*board, mDrcOptions,
                                     mProjectEditor.getDefaultLengthUnit(),
                                     "board_editor/drc_dialog", this);
   dialog.exec();
   mDrcOptions = dialog.getOptions();
+  mLiveDrc.reset();  // the options might have been changed
   if (dialog.getMessages()) {
     clearDrcMarker();
     mDrcMessages.insert(board->getUuid(), *dialog.getMessages());
@@ -733,8 +761,9 @@ void BoardEditor::on_actionDesignRuleCheck_triggered() {
 void BoardEditor::on_actionRebuildPlanes_triggered() {
   Board* board = getActiveBoard();
   if (board) {
-    board->rebuildAllPlanes();
-    board->forceAirWiresRebuild();
+    // only planes affected by modifications since the last rebuild
+    board->rebuildInvalidatedPlanes();
+    board->triggerAirWiresRebuild();
   }
 }
 
@@ -911,6 +940,44 @@ void BoardEditor::clearDrcMarker() noexcept {
   mGraphicsView->setSceneRectMarker(QRectF());
 }
 
+void BoardEditor::scheduleLiveDrc() noexcept {
+  if (mDrcMessagesDock && mDrcMessagesDock->isLiveCheckEnabled()) {
+    mLiveDrcTimer.start();  // restarts the timer if already running
+  }
+}
+
+void BoardEditor::runLiveDrc() noexcept {
+  Board* board = getActiveBoard();
+  if ((!board) || (!mDrcMessagesDock->isLiveCheckEnabled())) return;
+
+  // don't check half-finished modifications (e.g. while dragging items)
+  if (mProjectEditor.getUndoStack().isCommandGroupActive()) {
+    mLiveDrcTimer.start();
+    return;
+  }
+
+  try {
+    if (!mLiveDrc) {
+      mLiveDrc.reset(new BoardDesignRuleCheck(*board, mDrcOptions));
+      connect(mLiveDrc.data(), &BoardDesignRuleCheck::finished, this,
+              &BoardEditor::liveDrcFinished);
+    }
+    // only re-checks what was modified since the last run, in the background
+    mLiveDrc->startIncremental();
+  } catch (const Exception& e) {
+    mLiveDrc.reset();
+    qCritical() << "Live design rule check failed:" << e.getMsg();
+  }
+}
+
+void BoardEditor::liveDrcFinished() noexcept {
+  Board* board = getActiveBoard();
+  if ((!board) || (!mLiveDrc)) return;
+  clearDrcMarker();
+  mDrcMessages.insert(board->getUuid(), mLiveDrc->getMessages());
+  mDrcMessagesDock->setMessages(mLiveDrc->getMessages());
+}
+
 QList<BI_Device*> BoardEditor::getSearchCandidates() noexcept {
   QList<BI_Device*> candidates = {};
   if (Board* board = getActiveBoard()) {
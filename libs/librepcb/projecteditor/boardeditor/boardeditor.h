@@ -132,6 +132,9 @@ private:
   void highlightDrcMessage(const BoardDesignRuleCheckMessage& msg,
                            bool zoomTo) noexcept;
   void clearDrcMarker() noexcept;
+  void scheduleLiveDrc() noexcept;
+  void runLiveDrc() noexcept;
+  void liveDrcFinished() noexcept;
   QList<BI_Device*> getSearchCandidates() noexcept;
   QStringList getSearchToolBarCompleterList() noexcept;
   void goToDevice(const QString& name, unsigned int index) noexcept;
@@ -149,6 +152,8 @@ private:
   QHash<Uuid, QList<BoardDesignRuleCheckMessage>>
       mDrcMessages;  ///< Key: Board UUID
   QScopedPointer<QGraphicsPathItem> mDrcLocationGraphicsItem;
+  QScopedPointer<BoardDesignRuleCheck> mLiveDrc;  ///< Of the active board
+  QTimer mLiveDrcTimer;  ///< Delays the live DRC until editing pauses
 
   // Misc
   QPointer<Board> mActiveBoard;
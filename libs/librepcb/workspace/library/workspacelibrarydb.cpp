@@ -52,7 +52,7 @@ using namespace library;
  ******************************************************************************/
 
 WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws)
-  : QObject(nullptr), mWorkspace(ws) {
+  : QObject(nullptr), mWorkspace(ws), mFullTextSearch(false) {
   qDebug("Load workspace library database...");
 
   // open SQLite database
@@ -72,6 +72,10 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws)
     createAllTables();  // can throw
     setDbVersion(sCurrentDbVersion);  // can throw
   }
+  mFullTextSearch = isFullTextSearchAvailable();
+  if (!mFullTextSearch) {
+    qWarning() << "SQLite FTS5 not available, library search will be slow.";
+  }
 
   // create library scanner object
   mLibraryScanner.reset(new WorkspaceLibraryScanner(mWorkspace, mFilePath));
@@ -197,44 +201,51 @@ FilePath WorkspaceLibraryDb::getLatestDevice(const Uuid& uuid) const {
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Library>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("libraries", "lib_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("libraries", "lib_id", keyword, limit,
+                                    offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<ComponentCategory>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("component_categories", "cat_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("component_categories", "cat_id", keyword,
+                                    limit, offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<PackageCategory>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("package_categories", "cat_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("package_categories", "cat_id", keyword,
+                                    limit, offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Symbol>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("symbols", "symbol_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("symbols", "symbol_id", keyword, limit,
+                                    offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Package>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("packages", "package_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("packages", "package_id", keyword, limit,
+                                    offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Component>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("components", "component_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("components", "component_id", keyword,
+                                    limit, offset);
 }
 
 template <>
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword<Device>(
-    const QString& keyword) const {
-  return getElementsBySearchKeyword("devices", "device_id", keyword);
+    const QString& keyword, int limit, int offset) const {
+  return getElementsBySearchKeyword("devices", "device_id", keyword, limit,
+                                    offset);
 }
 
 /*******************************************************************************
@@ -517,6 +528,24 @@ void WorkspaceLibraryDb::startLibraryRescan() noexcept {
   mLibraryScanner->startScan();
 }
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QString WorkspaceLibraryDb::buildFullTextSearchQuery(
+    const QString& keyword) noexcept {
+  // Every term is quoted to avoid interpreting FTS5 operators and special
+  // characters, and gets a "*" appended to match words starting with it.
+  // Multiple terms are implicitly combined with AND.
+  QStringList terms =
+      keyword.split(QRegExp("\\s+"), QString::SkipEmptyParts);
+  for (QString& term : terms) {
+    term.replace("\"", "\"\"");
+    term = "\"" % term % "\"*";
+  }
+  return terms.join(" ");
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -699,19 +728,42 @@ QSet<Uuid> WorkspaceLibraryDb::getElementsByCategory(
 }
 
 QList<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword(
-    const QString& tablename, const QString& idrowname,
-    const QString& keyword) const {
-  QSqlQuery query = mDb->prepareQuery(QString("SELECT %1.uuid FROM %1, %1_tr "
-                                              "ON %1.id=%1_tr.%2 "
-                                              "WHERE %1_tr.name LIKE :keyword "
-                                              "OR %1_tr.keywords LIKE :keyword "
-                                              "ORDER BY %1_tr.name ASC ")
-                                          .arg(tablename, idrowname));
-  query.bindValue(":keyword", "%" + keyword + "%");
+    const QString& tablename, const QString& idrowname, const QString& keyword,
+    int limit, int offset) const {
+  QString ftsQuery = buildFullTextSearchQuery(keyword);
+  QSqlQuery query;
+  if (mFullTextSearch && (!ftsQuery.isEmpty())) {
+    // Use the full-text index, ranked by relevance (lower is better). Note
+    // that auxiliary functions like bm25() cannot be used in aggregates, thus
+    // the hidden "rank" column (which is bm25() by default) of the matches is
+    // selected in a subquery instead.
+    query = mDb->prepareQuery(
+        QString("SELECT %1.uuid FROM "
+                "(SELECT rowid AS id, rank FROM %1_fts "
+                "WHERE %1_fts MATCH :query) AS matches "
+                "INNER JOIN %1_tr ON %1_tr.id = matches.id "
+                "INNER JOIN %1 ON %1.id = %1_tr.%2 "
+                "GROUP BY %1.uuid "
+                "ORDER BY MIN(matches.rank) ASC, MIN(%1_tr.name) ASC "
+                "LIMIT :limit OFFSET :offset")
+            .arg(tablename, idrowname));
+    query.bindValue(":query", ftsQuery);
+  } else {
+    query = mDb->prepareQuery(QString("SELECT %1.uuid FROM %1, %1_tr "
+                                      "ON %1.id=%1_tr.%2 "
+                                      "WHERE %1_tr.name LIKE :keyword "
+                                      "OR %1_tr.keywords LIKE :keyword "
+                                      "GROUP BY %1.uuid "
+                                      "ORDER BY MIN(%1_tr.name) ASC "
+                                      "LIMIT :limit OFFSET :offset")
+                                  .arg(tablename, idrowname));
+    query.bindValue(":keyword", "%" + keyword + "%");
+  }
+  query.bindValue(":limit", limit);
+  query.bindValue(":offset", offset);
   mDb->exec(query);
 
   QList<Uuid> elements;
-  elements.reserve(query.size());
   while (query.next()) {
     elements.append(Uuid::fromString(query.value(0).toString()));  // can throw
   }
@@ -802,6 +854,7 @@ void WorkspaceLibraryDb::createAllTables() {
       "`id` INTEGER PRIMARY KEY NOT NULL, "
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
+      "`fingerprint` TEXT NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL, "
       "`parent_uuid` TEXT"
@@ -824,6 +877,7 @@ void WorkspaceLibraryDb::createAllTables() {
       "`id` INTEGER PRIMARY KEY NOT NULL, "
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
+      "`fingerprint` TEXT NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL, "
       "`parent_uuid` TEXT"
@@ -846,6 +900,7 @@ void WorkspaceLibraryDb::createAllTables() {
       "`id` INTEGER PRIMARY KEY NOT NULL, "
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
+      "`fingerprint` TEXT NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL"
       ")");
@@ -875,6 +930,7 @@ void WorkspaceLibraryDb::createAllTables() {
       "`id` INTEGER PRIMARY KEY NOT NULL, "
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
+      "`fingerprint` TEXT NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL "
       ")");
@@ -904,6 +960,7 @@ void WorkspaceLibraryDb::createAllTables() {
       "`id` INTEGER PRIMARY KEY NOT NULL, "
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
+      "`fingerprint` TEXT NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL"
       ")");
@@ -933,6 +990,7 @@ void WorkspaceLibraryDb::createAllTables() {
       "`id` INTEGER PRIMARY KEY NOT NULL, "
       "`lib_id` INTEGER NOT NULL, "
       "`filepath` TEXT UNIQUE NOT NULL, "
+      "`fingerprint` TEXT NOT NULL, "
       "`uuid` TEXT NOT NULL, "
       "`version` TEXT NOT NULL, "
       "`component_uuid` TEXT NOT NULL, "
@@ -963,6 +1021,66 @@ void WorkspaceLibraryDb::createAllTables() {
     QSqlQuery query = mDb->prepareQuery(string);  // can throw
     mDb->exec(query);  // can throw
   }
+
+  // full-text search indices (optional, as FTS5 might not be available)
+  try {
+    createFullTextSearchTables({"libraries", "component_categories",
+                                "package_categories", "symbols", "packages",
+                                "components", "devices"});  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Could not create full-text search tables:" << e.getMsg();
+  }
+}
+
+void WorkspaceLibraryDb::createFullTextSearchTables(const QStringList& tables) {
+  SQLiteDatabase::TransactionScopeGuard transactionGuard(*mDb);  // can throw
+  foreach (const QString& table, tables) {
+    // The FTS5 table only indexes the names and keywords of the "*_tr" table
+    // (external content table), so the strings are not stored twice. Triggers
+    // keep the index up to date, also when rows are removed by a cascade.
+    QStringList queries;
+    queries << QString(
+                   "CREATE VIRTUAL TABLE %1_fts USING fts5("
+                   "name, keywords, content='%1_tr', content_rowid='id', "
+                   "prefix='2 3')")
+                   .arg(table);
+    queries << QString(
+                   "CREATE TRIGGER %1_fts_insert AFTER INSERT ON %1_tr BEGIN "
+                   "INSERT INTO %1_fts(rowid, name, keywords) "
+                   "VALUES (new.id, new.name, new.keywords); "
+                   "END")
+                   .arg(table);
+    queries << QString(
+                   "CREATE TRIGGER %1_fts_delete AFTER DELETE ON %1_tr BEGIN "
+                   "INSERT INTO %1_fts(%1_fts, rowid, name, keywords) "
+                   "VALUES ('delete', old.id, old.name, old.keywords); "
+                   "END")
+                   .arg(table);
+    queries << QString(
+                   "CREATE TRIGGER %1_fts_update AFTER UPDATE ON %1_tr BEGIN "
+                   "INSERT INTO %1_fts(%1_fts, rowid, name, keywords) "
+                   "VALUES ('delete', old.id, old.name, old.keywords); "
+                   "INSERT INTO %1_fts(rowid, name, keywords) "
+                   "VALUES (new.id, new.name, new.keywords); "
+                   "END")
+                   .arg(table);
+    foreach (const QString& string, queries) {
+      QSqlQuery query = mDb->prepareQuery(string);  // can throw
+      mDb->exec(query);  // can throw
+    }
+  }
+  transactionGuard.commit();  // can throw
+}
+
+bool WorkspaceLibraryDb::isFullTextSearchAvailable() const noexcept {
+  try {
+    QSqlQuery query = mDb->prepareQuery(
+        "SELECT COUNT(*) FROM sqlite_master "
+        "WHERE type = 'table' AND name = 'devices_fts'");
+    return mDb->count(query) > 0;  // can throw
+  } catch (const Exception& e) {
+    return false;
+  }
 }
 
 int WorkspaceLibraryDb::getDbVersion() const noexcept {
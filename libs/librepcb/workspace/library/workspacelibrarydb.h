@@ -93,8 +93,28 @@ public:
   FilePath getLatestDevice(const Uuid& uuid) const;
 
   // Getters: Library elements by search keyword
+
+  /**
+   * @brief Search library elements by name or keywords
+   *
+   * Every whitespace-separated term of the keyword must match the beginning
+   * of a word in the name or keywords of an element. The results are sorted
+   * by relevance.
+   *
+   * @note In contrast to a plain substring search, terms only match at the
+   *       beginning of words, e.g. "res" finds "Resistor" but "sistor" does
+   *       not. If SQLite was built without FTS5, the search falls back to
+   *       substring matching of the whole keyword, sorted by name.
+   *
+   * @param keyword   The search term(s)
+   * @param limit     Maximum number of returned elements (-1 = unlimited)
+   * @param offset    Number of elements to skip (for paging the results)
+   *
+   * @return UUIDs of all matching elements
+   */
   template <typename ElementType>
-  QList<Uuid> getElementsBySearchKeyword(const QString& keyword) const;
+  QList<Uuid> getElementsBySearchKeyword(const QString& keyword, int limit = -1,
+                                         int offset = 0) const;
 
   // Getters: Library elements of a specified library
   template <typename ElementType>
@@ -139,6 +159,17 @@ public:
   // Operator Overloadings
   WorkspaceLibraryDb& operator=(const WorkspaceLibraryDb& rhs) = delete;
 
+  // Static Methods
+
+  /**
+   * @brief Build an FTS5 query from a search keyword entered by the user
+   *
+   * @param keyword   The search term(s), see #getElementsBySearchKeyword()
+   *
+   * @return The FTS5 query string (empty if there are no search terms)
+   */
+  static QString buildFullTextSearchQuery(const QString& keyword) noexcept;
+
 signals:
 
   void scanStarted();
@@ -176,11 +207,14 @@ private:
       const tl::optional<Uuid>& categoryUuid) const;
   QList<Uuid> getElementsBySearchKeyword(const QString& tablename,
                                          const QString& idrowname,
-                                         const QString& keyword) const;
+                                         const QString& keyword, int limit,
+                                         int offset) const;
   int getLibraryId(const FilePath& lib) const;
   QList<FilePath> getLibraryElements(const FilePath& lib,
                                      const QString& tablename) const;
   void createAllTables();
+  void createFullTextSearchTables(const QStringList& tables);
+  bool isFullTextSearchAvailable() const noexcept;
   void setDbVersion(int version);
   int getDbVersion() const noexcept;
 
@@ -189,9 +223,10 @@ private:
   FilePath mFilePath;  ///< path to the SQLite database
   QScopedPointer<SQLiteDatabase> mDb;  ///< the SQLite database
   QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;
+  bool mFullTextSearch;  ///< whether the FTS5 search tables are available
 
   // Constants
-  static const int sCurrentDbVersion = 2;
+  static const int sCurrentDbVersion = 4;
 };
 
 /*******************************************************************************
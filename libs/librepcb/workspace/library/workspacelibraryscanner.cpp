@@ -28,7 +28,9 @@
 #include <librepcb/common/sqlitedatabase.h>
 #include <librepcb/common/toolbox.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/libraryelementmetadata.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -49,12 +51,12 @@ WorkspaceLibraryScanner::WorkspaceLibraryScanner(
     mWorkspace(ws),
     mDbFilePath(dbFilePath),
     mSemaphore(0),
-    mAbort(false) {
+    mAbort(0) {
   start();
 }
 
 WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept {
-  mAbort = true;
+  mAbort.store(1);
   mSemaphore.release();
   if (!wait(2000)) {
     qWarning() << "Could not abort the library scanner worker thread!";
@@ -94,7 +96,7 @@ void WorkspaceLibraryScanner::run() noexcept {
 
   while (true) {
     mSemaphore.acquire();
-    if (mAbort) {
+    if (mAbort.load() != 0) {
       break;
     } else {
       scan();
@@ -127,12 +129,35 @@ void WorkspaceLibraryScanner::scan() noexcept {
     qDebug() << "Workspace libraries indexed:" << libIds.count()
              << "libraries in" << timer.elapsed() << "ms";
 
+    // Get all elements indexed by the previous scan. Unmodified elements are
+    // kept, modified and new elements are (re-)added, and all remaining
+    // elements are removed at the end since they no longer exist.
+    QHash<QString, IndexedElements> indexed;
+    QStringList tables = {"component_categories", "package_categories",
+                          "symbols",              "packages",
+                          "components",           "devices"};
+    bool rebuild = true;
+    foreach (const QString& table, tables) {
+      indexed.insert(table, getIndexedElements(db, table));  // can throw
+      rebuild = rebuild && indexed[table].isEmpty();
+    }
+
+    // When building the database from scratch, tune the connection for
+    // writing many rows. These settings only affect this connection, which is
+    // closed after the scan. The database is just a cache, so even durability
+    // is not needed (WAL mode is still required for readers). Incremental
+    // scans only write a few rows, so they keep the default settings.
+    if (rebuild) {
+      db.exec("PRAGMA synchronous = OFF");  // can throw
+      db.exec("PRAGMA cache_size = -32768");  // 32 MiB, can throw
+      db.exec("PRAGMA temp_store = MEMORY");  // can throw
+    } else {
+      db.exec("PRAGMA synchronous = NORMAL");  // can throw
+    }
+
     // begin database transaction
     SQLiteDatabase::TransactionScopeGuard transactionGuard(db);  // can throw
 
-    // clear all tables
-    clearAllTables(db);
-
     // scan all libraries
     int count = 0;
     qreal percent = 1;
@@ -141,40 +166,52 @@ void WorkspaceLibraryScanner::scan() noexcept {
       int libId = libIds[fp];
       const std::shared_ptr<Library>& lib = libraries[fp];
       Q_ASSERT(lib);
-      if (mAbort || (mSemaphore.available() > 0)) break;
-      count += addCategoriesToDb<ComponentCategory>(
+      if (isAborted()) break;
+      count += addElementsToDb<ComponentCategory>(
           db, fs, fp, lib->searchForElements<ComponentCategory>(),
-          "component_categories", "cat_id", libId);
+          "component_categories", "cat_id", libId,
+          indexed["component_categories"]);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
-      if (mAbort || (mSemaphore.available() > 0)) break;
-      count += addCategoriesToDb<PackageCategory>(
+      if (isAborted()) break;
+      count += addElementsToDb<PackageCategory>(
           db, fs, fp, lib->searchForElements<PackageCategory>(),
-          "package_categories", "cat_id", libId);
+          "package_categories", "cat_id", libId, indexed["package_categories"]);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
-      if (mAbort || (mSemaphore.available() > 0)) break;
+      if (isAborted()) break;
       count +=
           addElementsToDb<Symbol>(db, fs, fp, lib->searchForElements<Symbol>(),
-                                  "symbols", "symbol_id", libId);
+                                  "symbols", "symbol_id", libId,
+                                  indexed["symbols"]);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
-      if (mAbort || (mSemaphore.available() > 0)) break;
-      count += addElementsToDb<Package>(db, fs, fp,
-                                        lib->searchForElements<Package>(),
-                                        "packages", "package_id", libId);
+      if (isAborted()) break;
+      count += addElementsToDb<Package>(
+          db, fs, fp, lib->searchForElements<Package>(), "packages",
+          "package_id", libId, indexed["packages"]);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
-      if (mAbort || (mSemaphore.available() > 0)) break;
-      count += addElementsToDb<Component>(db, fs, fp,
-                                          lib->searchForElements<Component>(),
-                                          "components", "component_id", libId);
+      if (isAborted()) break;
+      count += addElementsToDb<Component>(
+          db, fs, fp, lib->searchForElements<Component>(), "components",
+          "component_id", libId, indexed["components"]);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
-      if (mAbort || (mSemaphore.available() > 0)) break;
+      if (isAborted()) break;
       count +=
           addElementsToDb<Device>(db, fs, fp, lib->searchForElements<Device>(),
-                                  "devices", "device_id", libId);
+                                  "devices", "device_id", libId,
+                                  indexed["devices"]);
       emit scanProgressUpdate(percent += qreal(98) / (libraries.count() * 6));
     }
 
+    // remove elements which no longer exist
+    foreach (const QString& table, indexed.keys()) {
+      if (isAborted()) break;
+      const IndexedElements& elements = indexed[table];
+      for (auto it = elements.constBegin(); it != elements.constEnd(); ++it) {
+        removeElementFromDb(db, table, it.value().first);  // can throw
+      }
+    }
+
     // commit transaction
-    if ((!mAbort) && (mSemaphore.available() == 0)) {
+    if (!isAborted()) {
       transactionGuard.commit();  // can throw
       qDebug() << "Workspace library scan succeeded:" << count << "elements in"
                << timer.elapsed() << "ms";
@@ -303,185 +340,247 @@ QHash<QString, int> WorkspaceLibraryScanner::updateLibraries(
   return dbLibIds;
 }
 
-void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db) {
-  // component categories
-  db.clearTable("component_categories_tr");
-  db.clearTable("component_categories");
-
-  // package categories
-  db.clearTable("package_categories_tr");
-  db.clearTable("package_categories");
-
-  // symbols
-  db.clearTable("symbols_tr");
-  db.clearTable("symbols_cat");
-  db.clearTable("symbols");
-
-  // packages
-  db.clearTable("packages_tr");
-  db.clearTable("packages_cat");
-  db.clearTable("packages");
-
-  // components
-  db.clearTable("components_tr");
-  db.clearTable("components_cat");
-  db.clearTable("components");
-
-  // devices
-  db.clearTable("devices_tr");
-  db.clearTable("devices_cat");
-  db.clearTable("devices");
+WorkspaceLibraryScanner::IndexedElements
+    WorkspaceLibraryScanner::getIndexedElements(SQLiteDatabase& db,
+                                                const QString& table) {
+  IndexedElements elements;
+  QSqlQuery query =
+      db.prepareQuery("SELECT id, filepath, fingerprint FROM " % table);
+  db.exec(query);
+  while (query.next()) {
+    int id = query.value(0).toInt();
+    QString fp = query.value(1).toString();
+    if (fp.isEmpty()) throw LogicError(__FILE__, __LINE__);
+    elements.insert(fp, qMakePair(id, query.value(2).toString()));
+  }
+  return elements;
+}
+
+void WorkspaceLibraryScanner::removeElementFromDb(SQLiteDatabase& db,
+                                                  const QString& table,
+                                                  int id) {
+  // translations and categories are removed by the foreign key constraints
+  QSqlQuery& query =
+      db.prepareCachedQuery("DELETE FROM " % table % " WHERE id = :id");
+  query.bindValue(":id", id);
+  db.exec(query);
+}
+
+QString WorkspaceLibraryScanner::getFingerprint(
+    const TransactionalFileSystem& fs, const QString& dirpath) noexcept {
+  // Only the size and modification time of the files are taken into account
+  // to avoid reading all the files. This is good enough since library
+  // elements are always modified by writing their files.
+  QString fingerprint;
+  QDir dir(fs.getAbsPath(dirpath).toStr());
+  foreach (const QFileInfo& info,
+           dir.entryInfoList(QDir::Files | QDir::Hidden, QDir::Name)) {
+    fingerprint += info.fileName() % "|" % QString::number(info.size()) % "|" %
+        QString::number(info.lastModified().toMSecsSinceEpoch()) % "\n";
+  }
+  return QString::fromLatin1(
+      QCryptographicHash::hash(fingerprint.toUtf8(), QCryptographicHash::Md5)
+          .toHex());
 }
 
 template <typename ElementType>
-int WorkspaceLibraryScanner::addCategoriesToDb(
+int WorkspaceLibraryScanner::addElementsToDb(
     SQLiteDatabase& db, std::shared_ptr<TransactionalFileSystem> fs,
     const QString& libPath, const QStringList& dirs, const QString& table,
-    const QString& idColumn, int libId) {
+    const QString& idColumn, int libId, IndexedElements& indexed) {
   int count = 0;
+
+  // Parse all new or modified elements in worker threads. The database is
+  // only accessed from this thread, where the parsed elements are added in
+  // their original order while the worker threads parse the next elements.
+  QStringList paths;
+  QStringList fingerprints;
+  QList<QFuture<ElementMetadata>> futures;
   foreach (const QString& dirpath, dirs) {
-    if (mAbort || (mSemaphore.available() > 0)) break;
+    if (isAborted()) break;
     QString fullPath = libPath % "/" % dirpath;
-    try {
-      std::unique_ptr<TransactionalDirectory> dir(
-          new TransactionalDirectory(fs, fullPath));  // can throw
-      ElementType element(std::move(dir));  // can throw
-      QSqlQuery query = db.prepareQuery(
-          "INSERT INTO " % table %
-          " "
-          "(lib_id, filepath, uuid, version, parent_uuid) VALUES "
-          "(:lib_id, :filepath, :uuid, :version, :parent_uuid)");
-      query.bindValue(":lib_id", libId);
-      query.bindValue(":filepath", fullPath);
-      query.bindValue(":uuid", element.getUuid().toStr());
-      query.bindValue(":version", element.getVersion().toStr());
-      query.bindValue(":parent_uuid",
-                      element.getParentUuid() ? element.getParentUuid()->toStr()
-                                              : QVariant(QVariant::String));
-      int id = db.insert(query);
-      foreach (const QString& locale, element.getAllAvailableLocales()) {
-        QSqlQuery query = db.prepareQuery(
-            "INSERT INTO " % table %
-            "_tr "
-            "(" %
-            idColumn %
-            ", locale, name, description, keywords) VALUES "
-            "(:element_id, :locale, :name, :description, :keywords)");
-        query.bindValue(":element_id", id);
-        query.bindValue(":locale", locale);
-        query.bindValue(":name",
-                        optionalToVariant(element.getNames().tryGet(locale)));
-        query.bindValue(
-            ":description",
-            optionalToVariant(element.getDescriptions().tryGet(locale)));
-        query.bindValue(
-            ":keywords",
-            optionalToVariant(element.getKeywords().tryGet(locale)));
-        db.insert(query);
-      }
+    QString fingerprint = getFingerprint(*fs, fullPath);
+    if (isElementUpToDate(db, table, indexed, fullPath, fingerprint)) {
       count++;
-    } catch (const Exception& e) {
-      qWarning() << "Failed to open library element:" << fullPath;
+      continue;
+    }
+    paths.append(fullPath);
+    fingerprints.append(fingerprint);
+    auto parser = [this, fs, fullPath]() {
+      return parseElement<ElementType>(fs, fullPath);
+    };
+    // Use a dedicated thread pool to not block the global thread pool with
+    // thousands of queued elements (not supported before Qt 5.4).
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
+    futures.append(QtConcurrent::run(&mThreadPool, parser));
+#else
+    futures.append(QtConcurrent::run(parser));
+#endif
+  }
+
+  // Wait for *all* threads, even if the scan was aborted, since they access
+  // this object. Aborted threads return immediately.
+  for (int i = 0; i < futures.count(); ++i) {
+    ElementMetadata metadata = futures[i].result();
+    if (metadata.valid && (!isAborted())) {
+      try {
+        addElementToDb(db, table, idColumn, libId, paths[i], fingerprints[i],
+                       metadata);  // can throw
+        count++;
+      } catch (const Exception& e) {
+        qWarning() << "Failed to add library element to database:" << paths[i];
+      }
     }
   }
   return count;
 }
 
+bool WorkspaceLibraryScanner::isElementUpToDate(SQLiteDatabase& db,
+                                                const QString& table,
+                                                IndexedElements& indexed,
+                                                const QString& path,
+                                                const QString& fingerprint) {
+  auto it = indexed.find(path);
+  if (it == indexed.end()) {
+    return false;  // new element
+  }
+  bool upToDate = (it.value().second == fingerprint);
+  if (!upToDate) {
+    removeElementFromDb(db, table, it.value().first);  // can throw
+  }
+  indexed.erase(it);  // don't remove it at the end of the scan
+  return upToDate;
+}
+
 template <typename ElementType>
-int WorkspaceLibraryScanner::addElementsToDb(
-    SQLiteDatabase& db, std::shared_ptr<TransactionalFileSystem> fs,
-    const QString& libPath, const QStringList& dirs, const QString& table,
-    const QString& idColumn, int libId) {
-  int count = 0;
-  foreach (const QString& dirpath, dirs) {
-    if (mAbort || (mSemaphore.available() > 0)) break;
-    QString fullPath = libPath % "/" % dirpath;
-    try {
-      std::unique_ptr<TransactionalDirectory> dir(
-          new TransactionalDirectory(fs, fullPath));  // can throw
-      ElementType element(std::move(dir));  // can throw
-      addElementToDb(db, table, idColumn, libId, fullPath, element);
-      count++;
-    } catch (const Exception& e) {
-      qWarning() << "Failed to open library element:" << fullPath;
+WorkspaceLibraryScanner::ElementMetadata WorkspaceLibraryScanner::parseElement(
+    std::shared_ptr<TransactionalFileSystem> fs, const QString& path) const
+    noexcept {
+  // Note: This is executed in a worker thread!
+  ElementMetadata metadata;
+  metadata.valid = false;
+  if (isAborted()) return metadata;
+  try {
+    // Only the metadata is needed for the database, so avoid loading the
+    // whole element (e.g. all footprints of a package).
+    TransactionalDirectory dir(fs, path);  // can throw
+    LibraryElementMetadata element =
+        LibraryElementMetadata::open<ElementType>(dir);  // can throw
+    metadata.uuid = element.getUuid().toStr();
+    metadata.version = element.getVersion().toStr();
+    foreach (const QString& locale, element.getAllAvailableLocales()) {
+      metadata.translations.append(ElementTranslation{
+          locale, optionalToVariant(element.getNames().tryGet(locale)),
+          optionalToVariant(element.getDescriptions().tryGet(locale)),
+          optionalToVariant(element.getKeywords().tryGet(locale))});
     }
+    getTypeSpecificMetadata<ElementType>(element, metadata);  // can throw
+    metadata.valid = true;
+  } catch (const Exception& e) {
+    qWarning() << "Failed to open library element:" << path;
   }
-  return count;
+  return metadata;
 }
 
 template <typename ElementType>
+void WorkspaceLibraryScanner::getTypeSpecificMetadata(
+    const LibraryElementMetadata& element, ElementMetadata& metadata) {
+  metadata.categories = element.getCategories();
+}
+
+template <>
+void WorkspaceLibraryScanner::getTypeSpecificMetadata<ComponentCategory>(
+    const LibraryElementMetadata& element, ElementMetadata& metadata) {
+  metadata.columns.append(qMakePair(
+      QString("parent_uuid"),
+      element.getParentUuid() ? QVariant(element.getParentUuid()->toStr())
+                              : QVariant(QVariant::String)));
+}
+
+template <>
+void WorkspaceLibraryScanner::getTypeSpecificMetadata<PackageCategory>(
+    const LibraryElementMetadata& element, ElementMetadata& metadata) {
+  metadata.columns.append(qMakePair(
+      QString("parent_uuid"),
+      element.getParentUuid() ? QVariant(element.getParentUuid()->toStr())
+                              : QVariant(QVariant::String)));
+}
+
+template <>
+void WorkspaceLibraryScanner::getTypeSpecificMetadata<Device>(
+    const LibraryElementMetadata& element, ElementMetadata& metadata) {
+  if ((!element.getComponentUuid()) || (!element.getPackageUuid())) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("The device has no component or package."));
+  }
+  metadata.categories = element.getCategories();
+  metadata.columns.append(qMakePair(
+      QString("component_uuid"),
+      QVariant(element.getComponentUuid()->toStr())));
+  metadata.columns.append(qMakePair(
+      QString("package_uuid"), QVariant(element.getPackageUuid()->toStr())));
+}
+
 void WorkspaceLibraryScanner::addElementToDb(SQLiteDatabase& db,
                                              const QString& table,
                                              const QString& idColumn, int libId,
                                              const QString& path,
-                                             const ElementType& element) {
-  QSqlQuery query = db.prepareQuery("INSERT INTO " % table %
-                                    " (lib_id, filepath, uuid, version) VALUES "
-                                    "(:lib_id, :filepath, :uuid, :version)");
-  query.bindValue(":lib_id", libId);
-  query.bindValue(":filepath", path);
-  query.bindValue(":uuid", element.getUuid().toStr());
-  query.bindValue(":version", element.getVersion().toStr());
-  int id = db.insert(query);
-  addElementTranslationsToDb(db, table % "_tr", idColumn, id, element);
-  addElementCategoriesToDb(db, table % "_cat", idColumn, id,
-                           element.getCategories());
-}
-
-template <>
-void WorkspaceLibraryScanner::addElementToDb<Device>(
-    SQLiteDatabase& db, const QString& table, const QString& idColumn,
-    int libId, const QString& path, const Device& element) {
-  QSqlQuery query = db.prepareQuery("INSERT INTO " % table %
-                                    " "
-                                    "(lib_id, filepath, uuid, version, "
-                                    "component_uuid, package_uuid) VALUES "
-                                    "(:lib_id, :filepath, :uuid, :version, "
-                                    ":component_uuid, :package_uuid)");
+                                             const QString& fingerprint,
+                                             const ElementMetadata& metadata) {
+  QString columns = "lib_id, filepath, fingerprint, uuid, version";
+  QString values = ":lib_id, :filepath, :fingerprint, :uuid, :version";
+  for (const QPair<QString, QVariant>& column : metadata.columns) {
+    columns += ", " % column.first;
+    values += ", :" % column.first;
+  }
+  QSqlQuery& query = db.prepareCachedQuery(
+      "INSERT INTO " % table % " (" % columns % ") VALUES (" % values % ")");
   query.bindValue(":lib_id", libId);
   query.bindValue(":filepath", path);
-  query.bindValue(":uuid", element.getUuid().toStr());
-  query.bindValue(":version", element.getVersion().toStr());
-  query.bindValue(":component_uuid", element.getComponentUuid().toStr());
-  query.bindValue(":package_uuid", element.getPackageUuid().toStr());
+  query.bindValue(":fingerprint", fingerprint);
+  query.bindValue(":uuid", metadata.uuid);
+  query.bindValue(":version", metadata.version);
+  for (const QPair<QString, QVariant>& column : metadata.columns) {
+    query.bindValue(":" % column.first, column.second);
+  }
   int id = db.insert(query);
-  addElementTranslationsToDb(db, table % "_tr", idColumn, id, element);
-  addElementCategoriesToDb(db, table % "_cat", idColumn, id,
-                           element.getCategories());
-}
 
-template <typename ElementType>
-void WorkspaceLibraryScanner::addElementTranslationsToDb(
-    SQLiteDatabase& db, const QString& table, const QString& idColumn, int id,
-    const ElementType& element) {
-  foreach (const QString& locale, element.getAllAvailableLocales()) {
-    QSqlQuery query = db.prepareQuery(
-        "INSERT INTO " % table % " (" % idColumn %
-        ", locale, name, description, keywords) VALUES "
-        "(:element_id, :locale, :name, :description, :keywords)");
-    query.bindValue(":element_id", id);
-    query.bindValue(":locale", locale);
-    query.bindValue(":name",
-                    optionalToVariant(element.getNames().tryGet(locale)));
-    query.bindValue(
-        ":description",
-        optionalToVariant(element.getDescriptions().tryGet(locale)));
-    query.bindValue(":keywords",
-                    optionalToVariant(element.getKeywords().tryGet(locale)));
-    db.insert(query);
+  // Translations and categories are inserted with one statement per element.
+  // The statements are cached per row count, which is small anyway.
+  if (!metadata.translations.isEmpty()) {
+    QStringList rows;
+    for (int i = 0; i < metadata.translations.count(); ++i) {
+      rows.append("(?, ?, ?, ?, ?)");
+    }
+    QSqlQuery& query = db.prepareCachedQuery(
+        "INSERT INTO " % table % "_tr (" % idColumn %
+        ", locale, name, description, keywords) VALUES " % rows.join(", "));
+    int index = 0;
+    foreach (const ElementTranslation& tr, metadata.translations) {
+      query.bindValue(index++, id);
+      query.bindValue(index++, tr.locale);
+      query.bindValue(index++, tr.name);
+      query.bindValue(index++, tr.description);
+      query.bindValue(index++, tr.keywords);
+    }
+    db.exec(query);
   }
-}
 
-void WorkspaceLibraryScanner::addElementCategoriesToDb(
-    SQLiteDatabase& db, const QString& table, const QString& idColumn, int id,
-    const QSet<Uuid>& categories) {
-  foreach (const Uuid& categoryUuid, categories) {
-    QSqlQuery query = db.prepareQuery("INSERT INTO " % table % " (" % idColumn %
-                                      ", category_uuid) VALUES "
-                                      "(:element_id, :category_uuid)");
-    query.bindValue(":element_id", id);
-    query.bindValue(":category_uuid", categoryUuid.toStr());
-    db.insert(query);
+  if (!metadata.categories.isEmpty()) {
+    QStringList rows;
+    for (int i = 0; i < metadata.categories.count(); ++i) {
+      rows.append("(?, ?)");
+    }
+    QSqlQuery& query = db.prepareCachedQuery("INSERT INTO " % table % "_cat (" %
+                                             idColumn %
+                                             ", category_uuid) VALUES " %
+                                             rows.join(", "));
+    int index = 0;
+    foreach (const Uuid& categoryUuid, metadata.categories) {
+      query.bindValue(index++, id);
+      query.bindValue(index++, categoryUuid.toStr());
+    }
+    db.exec(query);
   }
 }
 
@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/uuid.h>
 
 #include <QtCore>
 
@@ -35,12 +36,12 @@
 
 namespace librepcb {
 
-class Uuid;
 class SQLiteDatabase;
 class TransactionalFileSystem;
 
 namespace library {
 class Library;
+class LibraryElementMetadata;
 }
 
 namespace workspace {
@@ -82,46 +83,73 @@ signals:
   void scanFailed(QString errorMsg);
   void scanFinished();
 
+private:  // Types
+  /// Element ID and fingerprint of indexed elements, by their file path
+  typedef QHash<QString, QPair<int, QString>> IndexedElements;
+
+  /// Translation of a library element as stored in the database
+  struct ElementTranslation {
+    QString locale;
+    QVariant name;
+    QVariant description;
+    QVariant keywords;
+  };
+
+  /// All data of a library element which is stored in the database
+  struct ElementMetadata {
+    bool valid;  ///< false if the element could not be opened
+    QString uuid;
+    QString version;
+    QList<QPair<QString, QVariant>> columns;  ///< Type specific columns
+    QList<ElementTranslation> translations;
+    QSet<Uuid> categories;
+  };
+
 private:  // Methods
   void run() noexcept override;
   void scan() noexcept;
+  bool isAborted() const noexcept {
+    return (mAbort.load() != 0) || (mSemaphore.available() > 0);
+  }
   QHash<QString, int> updateLibraries(
       SQLiteDatabase& db,
       const QHash<QString, std::shared_ptr<library::Library>>& libs);
-  void clearAllTables(SQLiteDatabase& db);
+  IndexedElements getIndexedElements(SQLiteDatabase& db, const QString& table);
+  void removeElementFromDb(SQLiteDatabase& db, const QString& table, int id);
+  static QString getFingerprint(const TransactionalFileSystem& fs,
+                                const QString& dirpath) noexcept;
   void getLibrariesOfDirectory(
       std::shared_ptr<TransactionalFileSystem> fs, const QString& root,
       QHash<QString, std::shared_ptr<library::Library>>& libs) noexcept;
   template <typename ElementType>
-  int addCategoriesToDb(SQLiteDatabase& db,
-                        std::shared_ptr<TransactionalFileSystem> fs,
-                        const QString& libPath, const QStringList& dirs,
-                        const QString& table, const QString& idColumn,
-                        int libId);
-  template <typename ElementType>
   int addElementsToDb(SQLiteDatabase& db,
                       std::shared_ptr<TransactionalFileSystem> fs,
                       const QString& libPath, const QStringList& dirs,
-                      const QString& table, const QString& idColumn, int libId);
+                      const QString& table, const QString& idColumn, int libId,
+                      IndexedElements& indexed);
+  bool isElementUpToDate(SQLiteDatabase& db, const QString& table,
+                         IndexedElements& indexed, const QString& path,
+                         const QString& fingerprint);
   template <typename ElementType>
+  ElementMetadata parseElement(std::shared_ptr<TransactionalFileSystem> fs,
+                               const QString& path) const noexcept;
+  template <typename ElementType>
+  static void getTypeSpecificMetadata(
+      const library::LibraryElementMetadata& element,
+      ElementMetadata& metadata);
   void addElementToDb(SQLiteDatabase& db, const QString& table,
                       const QString& idColumn, int libId, const QString& path,
-                      const ElementType& element);
-  template <typename ElementType>
-  void addElementTranslationsToDb(SQLiteDatabase& db, const QString& table,
-                                  const QString& idColumn, int id,
-                                  const ElementType& element);
-  void addElementCategoriesToDb(SQLiteDatabase& db, const QString& table,
-                                const QString& idColumn, int id,
-                                const QSet<Uuid>& categories);
+                      const QString& fingerprint,
+                      const ElementMetadata& metadata);
   template <typename T>
   static QVariant optionalToVariant(const T& opt) noexcept;
 
 private:  // Data
   Workspace& mWorkspace;
   FilePath mDbFilePath;
-  QSemaphore mSemaphore;
-  volatile bool mAbort;
+  QSemaphore mSemaphore;  ///< Also accessed by the element parser threads
+  QThreadPool mThreadPool;  ///< Runs the element parser threads
+  QAtomicInt mAbort;  ///< Also accessed by the element parser threads
 };
 
 /*******************************************************************************
@@ -288,3 +288,40 @@ def test_if_export_with_invalid_settings_fails(cli, project):
     assert len(stdout) > 0
     assert stdout[-1] == 'Finished with errors!'
     assert not os.path.exists(dir)
+
+
+@pytest.mark.parametrize("jobs", ['1', '4'])
+@pytest.mark.parametrize("project", [
+    params.EMPTY_PROJECT_LPP_PARAM,
+])
+def test_export_with_jobs(cli, project, jobs):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    dir = cli.abspath(project.output_dir + '/gerber')
+    assert not os.path.exists(dir)
+    code, stdout, stderr = cli.run('open-project',
+                                   '--export-pcb-fabrication-data',
+                                   '--jobs=' + jobs,
+                                   project.path)
+    assert code == 0
+    assert len(stderr) == 0
+    assert len(stdout) > 0
+    assert stdout[-1] == 'SUCCESS'
+    assert os.path.exists(dir)
+    assert len(os.listdir(dir)) == 8
+
+
+@pytest.mark.parametrize("jobs", ['0', 'foo'])
+@pytest.mark.parametrize("project", [
+    params.EMPTY_PROJECT_LPP_PARAM,
+])
+def test_if_invalid_jobs_fails(cli, project, jobs):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    dir = cli.abspath(project.output_dir + '/gerber')
+    code, stdout, stderr = cli.run('open-project',
+                                   '--export-pcb-fabrication-data',
+                                   '--jobs=' + jobs,
+                                   project.path)
+    assert code == 1
+    assert len(stderr) > 0
+    assert "Invalid value for option '--jobs'" in stderr[0]
+    assert not os.path.exists(dir)
@@ -21,11 +21,17 @@
  *  Includes
  ******************************************************************************/
 
+#include <delaunay-triangulation/delaunay.h>
 #include <gtest/gtest.h>
 #include <librepcb/common/algorithm/airwiresbuilder.h>
 
 #include <QtCore>
 
+#include <functional>
+#include <iostream>
+#include <random>
+#include <tuple>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -48,6 +54,85 @@ protected:
     std::sort(airwires.begin(), airwires.end());
     return airwires;
   }
+
+  static qreal totalLength(const AirWiresBuilder::AirWires& airwires) noexcept {
+    qreal length = 0;
+    foreach (const AirWiresBuilder::AirWire& airwire, airwires) {
+      length += (airwire.second - airwire.first).getLength()->toMm();
+    }
+    return length;
+  }
+
+  static QVector<Point> randomPoints(int count, std::mt19937& rng) noexcept {
+    std::uniform_int_distribution<qint64> distribution(0, 300000000);
+    QVector<Point> points;
+    for (int i = 0; i < count; ++i) {
+      points.append(Point(distribution(rng), distribution(rng)));
+    }
+    return points;
+  }
+
+  // Reference: Kruskal on all edges (exact, but O(n^2 log n))
+  static AirWiresBuilder::AirWires bruteForceMst(
+      const QVector<Point>& points) noexcept {
+    QVector<std::tuple<qreal, int, int>> edges;
+    for (int i = 0; i < points.count(); ++i) {
+      for (int k = i + 1; k < points.count(); ++k) {
+        Point diff = points.at(k) - points.at(i);
+        qreal dx = diff.getX().toMm(), dy = diff.getY().toMm();
+        edges.append(std::make_tuple(dx * dx + dy * dy, i, k));
+      }
+    }
+    std::sort(edges.begin(), edges.end());
+    return kruskal(points, edges);
+  }
+
+  // Reference: The previous implementation (Delaunay triangulation with
+  // floating point coordinates, plus fallback edges, plus Kruskal)
+  static AirWiresBuilder::AirWires delaunayMst(
+      const QVector<Point>& points) noexcept {
+    std::vector<delaunay::Vector2<qreal>> vertices;
+    for (int i = 0; i < points.count(); ++i) {
+      vertices.emplace_back(points.at(i).getX().toNm(),
+                            points.at(i).getY().toNm(), i);
+    }
+    QVector<std::tuple<qreal, int, int>> edges;
+    for (int i = 1; i < points.count(); ++i) {
+      edges.append(
+          std::make_tuple(vertices[i - 1].dist2(vertices[i]), i - 1, i));
+    }
+    delaunay::Delaunay<qreal> del;
+    del.triangulate(vertices);
+    for (const delaunay::Edge<qreal>& edge : del.getEdges()) {
+      edges.append(std::make_tuple(edge.p1.dist2(edge.p2), edge.p1.id,
+                                   edge.p2.id));
+    }
+    std::sort(edges.begin(), edges.end());
+    return kruskal(points, edges);
+  }
+
+  static AirWiresBuilder::AirWires kruskal(
+      const QVector<Point>& points,
+      const QVector<std::tuple<qreal, int, int>>& sortedEdges) noexcept {
+    QVector<int> parents;
+    for (int i = 0; i < points.count(); ++i) {
+      parents.append(i);
+    }
+    std::function<int(int)> findRoot = [&parents, &findRoot](int i) {
+      return (parents[i] == i) ? i : (parents[i] = findRoot(parents[i]));
+    };
+    AirWiresBuilder::AirWires airwires;
+    foreach (const auto& edge, sortedEdges) {
+      int root1 = findRoot(std::get<1>(edge));
+      int root2 = findRoot(std::get<2>(edge));
+      if (root1 != root2) {
+        parents[root1] = root2;
+        airwires.append(qMakePair(points.at(std::get<1>(edge)),
+                                  points.at(std::get<2>(edge))));
+      }
+    }
+    return airwires;
+  }
 };
 
 /*******************************************************************************
@@ -178,6 +263,193 @@ TEST_F(AirWiresBuilderTest, testPartlyConnectedColinearPoints) {
   EXPECT_EQ(expected, airwires);
 }
 
+TEST_F(AirWiresBuilderTest, testIncrementalAddEdge) {
+  AirWiresBuilder builder;
+  int id0 = builder.addPoint(Point(0, 0));
+  builder.addPoint(Point(1000000, 0));
+  builder.addPoint(Point(3000000, 0));
+  int id3 = builder.addPoint(Point(4000000, 0));
+  EXPECT_EQ(3, builder.buildAirWires().size());
+  builder.addEdge(id0, id3);  // closes cycle -> longest airwire is removed
+  AirWiresBuilder::AirWires airwires = sorted(builder.buildAirWires());
+  AirWiresBuilder::AirWires expected = {{Point(0, 0), Point(1000000, 0)},
+                                        {Point(3000000, 0), Point(4000000, 0)}};
+  EXPECT_EQ(expected, airwires);
+}
+
+TEST_F(AirWiresBuilderTest, testIncrementalAddEdgeAlreadyConnected) {
+  AirWiresBuilder builder;
+  int id0 = builder.addPoint(Point(0, 0));
+  int id1 = builder.addPoint(Point(1000000, 0));
+  int id2 = builder.addPoint(Point(3000000, 0));
+  builder.addEdge(id0, id1);
+  builder.addEdge(id1, id2);
+  EXPECT_EQ(0, builder.buildAirWires().size());
+  builder.addEdge(id0, id2);
+  EXPECT_EQ(0, builder.buildAirWires().size());
+}
+
+TEST_F(AirWiresBuilderTest, testIncrementalAddPoint) {
+  AirWiresBuilder builder;
+  builder.addPoint(Point(0, 0));
+  builder.addPoint(Point(1000000, 0));
+  EXPECT_EQ(1, builder.buildAirWires().size());
+  builder.addPoint(Point(500000, 100000));
+  AirWiresBuilder::AirWires airwires = sorted(builder.buildAirWires());
+  AirWiresBuilder::AirWires expected = {
+      {Point(0, 0), Point(500000, 100000)},
+      {Point(500000, 100000), Point(1000000, 0)}};
+  EXPECT_EQ(expected, airwires);
+}
+
+TEST_F(AirWiresBuilderTest, testIncrementalMatchesFullBuild) {
+  QVector<Point> points = {Point(0, 0),           Point(100000, 100000),
+                           Point(200000, 200000), Point(300000, 300000),
+                           Point(400000, 400000), Point(500000, 500000),
+                           Point(600000, 600000)};
+  AirWiresBuilder full;
+  AirWiresBuilder incremental;
+  foreach (const Point& p, points) {
+    full.addPoint(p);
+  }
+  for (int i = 0; i < 4; ++i) {
+    incremental.addPoint(points.at(i));
+  }
+  incremental.buildAirWires();
+  for (int i = 4; i < points.count(); ++i) {
+    incremental.addPoint(points.at(i));
+  }
+  full.addEdge(1, 2);
+  incremental.addEdge(1, 2);
+  EXPECT_EQ(sorted(full.buildAirWires()), sorted(incremental.buildAirWires()));
+}
+
+TEST_F(AirWiresBuilderTest, testIncrementalRemovePoint) {
+  AirWiresBuilder builder;
+  int id0 = builder.addPoint(Point(0, 0));
+  int id1 = builder.addPoint(Point(1000000, 0));
+  int id2 = builder.addPoint(Point(2000000, 0));
+  builder.addPoint(Point(2000000, 3000000));
+  builder.addEdge(id0, id1);
+  builder.addEdge(id1, id2);
+  EXPECT_EQ(1, builder.buildAirWires().size());
+  builder.removePoint(id1);  // splits the connected subset
+  AirWiresBuilder::AirWires airwires = sorted(builder.buildAirWires());
+  AirWiresBuilder::AirWires expected = {
+      {Point(0, 0), Point(2000000, 0)},
+      {Point(2000000, 0), Point(2000000, 3000000)}};
+  EXPECT_EQ(expected, airwires);
+}
+
+TEST_F(AirWiresBuilderTest, testIncrementalMovePointsMatchesFullBuild) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> distribution(0, 99);
+  QVector<Point> points = randomPoints(100, rng);
+  QVector<int> ids;  // index in points -> ID in incremental builder
+  QSet<QPair<int, int>> edges;  // indices in points
+  AirWiresBuilder incremental;
+  foreach (const Point& p, points) {
+    ids.append(incremental.addPoint(p));
+  }
+  incremental.buildAirWires();
+  for (int i = 0; i < 20; ++i) {
+    // connect two points
+    int index1 = distribution(rng);
+    int index2 = distribution(rng);
+    incremental.addEdge(ids.at(index1), ids.at(index2));
+    edges.insert(qMakePair(index1, index2));
+
+    // move some points, i.e. remove them and add them again
+    QSet<int> moved = {distribution(rng), distribution(rng)};
+    foreach (int index, moved) {
+      incremental.removePoint(ids.at(index));
+      foreach (const auto& edge, edges) {
+        if ((edge.first == index) || (edge.second == index)) {
+          edges.remove(edge);
+        }
+      }
+    }
+    QVector<Point> newPoints = randomPoints(moved.count(), rng);
+    foreach (int index, moved) {
+      points[index] = newPoints.takeLast();
+      ids[index] = incremental.addPoint(points.at(index));
+    }
+    incremental.buildAirWires();
+  }
+
+  // The IDs differ from a full build, so the result might be different if
+  // there are airwires with equal lengths. Thus only compare the lengths.
+  AirWiresBuilder full;
+  foreach (const Point& p, points) {
+    full.addPoint(p);
+  }
+  foreach (const auto& edge, edges) {
+    full.addEdge(edge.first, edge.second);
+  }
+  AirWiresBuilder::AirWires expected = full.buildAirWires();
+  AirWiresBuilder::AirWires airwires = incremental.buildAirWires();
+  EXPECT_EQ(expected.count(), airwires.count());
+  EXPECT_NEAR(totalLength(expected), totalLength(airwires), 1e-6);
+}
+
+TEST_F(AirWiresBuilderTest, testRandomPoints) {
+  std::mt19937 rng(42);
+  for (int count : {4, 10, 50, 300}) {
+    QVector<Point> points = randomPoints(count, rng);
+    AirWiresBuilder builder;
+    foreach (const Point& p, points) {
+      builder.addPoint(p);
+    }
+    AirWiresBuilder::AirWires airwires = builder.buildAirWires();
+    AirWiresBuilder::AirWires expected = bruteForceMst(points);
+    EXPECT_EQ(expected.count(), airwires.count());
+    EXPECT_NEAR(totalLength(expected), totalLength(airwires), 1e-6);
+  }
+}
+
+TEST_F(AirWiresBuilderTest, testRandomPointsOnCoarseGrid) {
+  // many colinear and overlapping points
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> distribution(0, 5);
+  QVector<Point> points;
+  for (int i = 0; i < 100; ++i) {
+    points.append(Point(distribution(rng) * 1000000,
+                        distribution(rng) * 1000000));
+  }
+  AirWiresBuilder builder;
+  foreach (const Point& p, points) {
+    builder.addPoint(p);
+  }
+  AirWiresBuilder::AirWires airwires = builder.buildAirWires();
+  AirWiresBuilder::AirWires expected = bruteForceMst(points);
+  EXPECT_EQ(expected.count(), airwires.count());
+  EXPECT_NEAR(totalLength(expected), totalLength(airwires), 1e-6);
+}
+
+// Benchmark against the previous implementation, disabled by default since it
+// takes a long time. Run it with "--gtest_also_run_disabled_tests".
+TEST_F(AirWiresBuilderTest, DISABLED_benchmarkRandomPoints) {
+  std::mt19937 rng(42);
+  for (int count : {10000, 30000, 100000}) {
+    QVector<Point> points = randomPoints(count, rng);
+    QElapsedTimer timer;
+    timer.start();
+    AirWiresBuilder builder;
+    foreach (const Point& p, points) {
+      builder.addPoint(p);
+    }
+    AirWiresBuilder::AirWires airwires = builder.buildAirWires();
+    qint64 elapsed = timer.elapsed();
+    timer.restart();
+    AirWiresBuilder::AirWires reference = delaunayMst(points);
+    qint64 elapsedReference = timer.elapsed();
+    std::cout << count << " points: " << elapsed << " ms (previous: "
+              << elapsedReference << " ms)" << std::endl;
+    EXPECT_EQ(reference.count(), airwires.count());
+    EXPECT_LE(totalLength(airwires), totalLength(reference) + 1e-6);
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
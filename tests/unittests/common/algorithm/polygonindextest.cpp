@@ -0,0 +1,106 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/algorithm/polygonindex.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PolygonIndexTest : public ::testing::Test {
+protected:
+  // L-shaped polygon with a concave corner at (5mm, 5mm)
+  static Path lShape() noexcept {
+    return Path({Vertex(Point(0, 0)), Vertex(Point(10000000, 0)),
+                 Vertex(Point(10000000, 5000000)),
+                 Vertex(Point(5000000, 5000000)),
+                 Vertex(Point(5000000, 10000000)), Vertex(Point(0, 10000000)),
+                 Vertex(Point(0, 0))});
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PolygonIndexTest, testEmpty) {
+  PolygonIndex index;
+  EXPECT_EQ(0, index.count());
+  EXPECT_EQ(-1, index.indexOf(Point(0, 0)));
+}
+
+TEST_F(PolygonIndexTest, testContainsConcavePolygon) {
+  Path path = lShape();
+  EXPECT_TRUE(PolygonIndex::contains(path, Point(2000000, 2000000)));
+  EXPECT_TRUE(PolygonIndex::contains(path, Point(8000000, 2000000)));
+  EXPECT_TRUE(PolygonIndex::contains(path, Point(2000000, 8000000)));
+  EXPECT_FALSE(PolygonIndex::contains(path, Point(8000000, 8000000)));
+  EXPECT_FALSE(PolygonIndex::contains(path, Point(-1, 2000000)));
+  EXPECT_FALSE(PolygonIndex::contains(path, Point(2000000, 10000001)));
+}
+
+TEST_F(PolygonIndexTest, testContainsWithoutClosingVertex) {
+  Path path({Vertex(Point(0, 0)), Vertex(Point(10000000, 0)),
+             Vertex(Point(0, 10000000))});
+  EXPECT_TRUE(PolygonIndex::contains(path, Point(1000000, 1000000)));
+  EXPECT_FALSE(PolygonIndex::contains(path, Point(6000000, 6000000)));
+}
+
+TEST_F(PolygonIndexTest, testContainsMatchesQPainterPath) {
+  Path path = lShape();
+  for (int x = -1; x <= 11; ++x) {
+    for (int y = -1; y <= 11; ++y) {
+      Point p(x * 1000000 + 500000, y * 1000000 + 500000);
+      EXPECT_EQ(path.toQPainterPathPx().contains(p.toPxQPointF()),
+                PolygonIndex::contains(path, p))
+          << p.toMmQPointF().x() << "/" << p.toMmQPointF().y();
+    }
+  }
+}
+
+TEST_F(PolygonIndexTest, testIndexOf) {
+  Path left = lShape();
+  Path right = Path::rect(Point(20000000, 0), Point(30000000, 10000000));
+  PolygonIndex index({left, right});
+  EXPECT_EQ(2, index.count());
+  EXPECT_EQ(0, index.indexOf(Point(2000000, 2000000)));
+  EXPECT_EQ(1, index.indexOf(Point(25000000, 5000000)));
+  EXPECT_EQ(-1, index.indexOf(Point(8000000, 8000000)));  // in bounding box
+  EXPECT_EQ(-1, index.indexOf(Point(15000000, 5000000)));  // between
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
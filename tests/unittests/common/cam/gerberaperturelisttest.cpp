@@ -0,0 +1,85 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/gerberaperturelist.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GerberApertureListTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GerberApertureListTest, testSameApertureIsReused) {
+  GerberApertureList list;
+  UnsignedLength w(1000000);
+  UnsignedLength h(500000);
+  UnsignedLength hole(0);
+  EXPECT_EQ(10, list.setCircle(w, hole));
+  EXPECT_EQ(11, list.setRect(w, h, Angle::deg45(), hole));
+  EXPECT_EQ(10, list.setCircle(w, hole));
+  EXPECT_EQ(11, list.setRect(w, h, Angle::deg45(), hole));
+  EXPECT_EQ(12, list.setCircle(h, hole));
+  EXPECT_EQ(3, list.generateString().count("%ADD"));
+}
+
+TEST_F(GerberApertureListTest, testEquivalentParametersShareAperture) {
+  GerberApertureList list;
+  UnsignedLength w(1000000);
+  UnsignedLength h(500000);
+  UnsignedLength hole(0);
+  EXPECT_EQ(10, list.setRect(w, h, Angle::deg0(), hole));
+  EXPECT_EQ(10, list.setRect(w, h, Angle::deg180(), hole));
+  EXPECT_EQ(10, list.setRect(h, w, Angle::deg90(), hole));
+  EXPECT_EQ(11, list.setRect(w, h, Angle::deg90(), hole));
+  EXPECT_EQ(2, list.generateString().count("%ADD"));
+}
+
+TEST_F(GerberApertureListTest, testReset) {
+  GerberApertureList list;
+  UnsignedLength dia(1000000);
+  UnsignedLength hole(0);
+  EXPECT_EQ(10, list.setCircle(UnsignedLength(2000000), hole));
+  EXPECT_EQ(11, list.setCircle(dia, hole));
+  list.reset();
+  EXPECT_EQ(10, list.setCircle(dia, hole));
+  EXPECT_EQ(1, list.generateString().count("%ADD"));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
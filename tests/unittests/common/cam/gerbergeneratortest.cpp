@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/gerbergenerator.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/geometry/path.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GerberGeneratorTest : public ::testing::Test {
+protected:
+  FilePath mTempDir;
+
+  GerberGeneratorTest() { mTempDir = FilePath::getRandomTempPath(); }
+
+  virtual ~GerberGeneratorTest() { QDir(mTempDir.toStr()).removeRecursively(); }
+
+  static void draw(GerberGenerator& gen) {
+    gen.drawLine(Point(-1000, 2000), Point(3000, -4000), UnsignedLength(100));
+    gen.drawPathArea(Path::centeredRect(PositiveLength(5000000),
+                                        PositiveLength(2000000)));
+    gen.drawPathOutline(Path::circle(PositiveLength(1000000)),
+                        UnsignedLength(200000));
+    gen.flashCircle(Point(0, 0), UnsignedLength(1000), UnsignedLength(0));
+  }
+
+  // replace volatile data with well-known, constant data
+  static QByteArray normalize(const QByteArray& content) {
+    return QString::fromLatin1(content)
+        .replace(QRegularExpression("%TF\\.CreationDate,(.*)\\*%"), "")
+        .replace(QRegularExpression("%TF\\.MD5,.*\\*%"), "")
+        .toLatin1();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GerberGeneratorTest, testCoordinates) {
+  GerberGenerator gen("Project", Uuid::createRandom(), "1");
+  draw(gen);
+  gen.generate();
+  QByteArray output = gen.toByteArray();
+  EXPECT_TRUE(output.contains("X-1000Y2000D02*\n")) << output.toStdString();
+  EXPECT_TRUE(output.contains("X3000Y-4000D01*\n")) << output.toStdString();
+  EXPECT_TRUE(output.contains("X0Y0D03*\n")) << output.toStdString();
+  EXPECT_TRUE(output.endsWith("M02*\n")) << output.toStdString();
+}
+
+TEST_F(GerberGeneratorTest, testMd5Checksum) {
+  GerberGenerator gen("Project", Uuid::createRandom(), "1");
+  draw(gen);
+  gen.generate();
+  QByteArray output = gen.toByteArray();
+  int index = output.indexOf("%TF.MD5,");
+  ASSERT_GT(index, 0);
+  QByteArray data = output.left(index).replace('\n', QByteArray());
+  QByteArray md5 =
+      QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex();
+  EXPECT_EQ("%TF.MD5," + md5 + "*%\nM02*\n", output.mid(index));
+}
+
+TEST_F(GerberGeneratorTest, testGenerateToFile) {
+  GerberGenerator gen("Project", Uuid::createRandom(), "1");
+  draw(gen);
+  gen.generate();
+  QByteArray expected = gen.toByteArray();
+
+  FilePath fp = mTempDir.getPathTo("subdir/file.gbr");
+  gen.generateToFile(fp);
+  EXPECT_TRUE(gen.toByteArray().isEmpty());
+  QByteArray actual = FileUtils::readFile(fp);
+  EXPECT_EQ(normalize(expected).toStdString(),
+            normalize(actual).toStdString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/uuid.h>
 
 #include <QtCore>
 
@@ -150,11 +151,134 @@ TEST(SExpressionTest, testParsePartialExpression) {
   }
 }
 
+TEST(SExpressionTest, testParseFiltered) {
+  QByteArray input =
+      "(librepcb_package 71762d7e-e7f1-403c-8020-db9670c01e9b\n"
+      " (name \"Foo (bar)\")\n"
+      " (footprint 02a1e6d4-1c1a-4a5b-8a3c-ef6e1e8bb2bb ; comment with (\n"
+      "  (name \"Default \\\"(\\\"\")\n"
+      "  (pad (position 0.0 0.0))\n"
+      " )\n"
+      " (version \"0.1\")\n"
+      ")\n";
+  SExpression s = SExpression::parseFiltered(
+      input, FilePath(), QSet<QString>{"name", "version"});
+  EXPECT_EQ("71762d7e-e7f1-403c-8020-db9670c01e9b",
+            s.getChild("@0").getValue());
+  EXPECT_EQ("Foo (bar)", s.getChild("name/@0").getValue());
+  EXPECT_EQ("0.1", s.getChild("version/@0").getValue());
+  EXPECT_EQ(nullptr, s.tryGetChild("footprint"));
+  EXPECT_EQ(3, s.getChildren().count());
+}
+
+TEST(SExpressionTest, testParseFilteredWithMissingClosingBrace) {
+  EXPECT_THROW(SExpression::parseFiltered("(foo (bar (baz \")\")", FilePath(),
+                                          QSet<QString>{"name"}),
+               RuntimeError);
+}
+
+TEST(SExpressionTest, testParseStringWithUtf8Characters) {
+  QString value = QString::fromUtf8("\xC2\xB5\xE2\x84\xA6 \"\xC3\xA4\"");
+  SExpression s = SExpression::parse(
+      "(test \"\xC2\xB5\xE2\x84\xA6 \\\"\xC3\xA4\\\"\")", FilePath());
+  EXPECT_EQ(value, s.getChild("@0").getValue());
+}
+
+TEST(SExpressionTest, testParseWithUtf8Bom) {
+  SExpression s = SExpression::parse("\xEF\xBB\xBF(test \"\xC3\xA4\")",
+                                     FilePath());
+  EXPECT_EQ("test", s.getName());
+  EXPECT_EQ(QString::fromUtf8("\xC3\xA4"), s.getChild("@0").getValue());
+}
+
+TEST(SExpressionTest, testParseSetsFilePathOnAllNodes) {
+  FilePath fp("/tmp/board.lp");
+  SExpression s = SExpression::parse("(test (foo \"bar\") baz)", fp);
+  EXPECT_EQ(fp, s.getFilePath());
+  EXPECT_EQ(fp, s.getChild("foo").getFilePath());
+  EXPECT_EQ(fp, s.getChild("foo/@0").getFilePath());
+  EXPECT_EQ(fp, s.getChild("@1").getFilePath());
+}
+
+// Parse benchmark with a synthetic board of 100k elements, disabled by default
+// since it takes a long time. Run it with "--gtest_also_run_disabled_tests".
+TEST(SExpressionTest, DISABLED_benchmarkParseLargeBoard) {
+  const int count = 100000;
+  QByteArray input = "(librepcb_board 71762d7e-e7f1-403c-8020-db9670c01e9b\n";
+  for (int i = 0; i < count; ++i) {
+    input += " (via " + Uuid::createRandom().toStr().toUtf8() +
+        " (position " + QByteArray::number(i) + " 46.0375)" +
+        " (size 0.7) (drill 0.3) (shape round) (name \"Via \\\"" +
+        QByteArray::number(i) + "\\\"\")\n )\n";
+  }
+  input += ")\n";
+
+  QElapsedTimer timer;
+  timer.start();
+  SExpression s = SExpression::parse(input, FilePath());
+  RecordProperty("parse_time_ms", static_cast<int>(timer.elapsed()));
+
+  ASSERT_EQ(count + 1, s.getChildren().count());
+  const SExpression& last = s.getChildren().last();
+  EXPECT_EQ(QString::number(count - 1),
+            last.getChild("position/@0").getValue());
+  EXPECT_EQ(QString("Via \"%1\"").arg(count - 1),
+            last.getChild("name/@0").getValue());
+}
+
+TEST(SExpressionTest, testGetChildrenOfLargeList) {
+  // Large enough to make use of the child index.
+  SExpression s = SExpression::createList("test");
+  for (int i = 0; i < 100; ++i) {
+    s.appendChild((i % 2) ? "odd" : "even", i, true);
+  }
+  EXPECT_EQ(50, s.getChildren("odd").count());
+  EXPECT_EQ(50, s.getChildrenByName("even").count());
+  EXPECT_EQ("1", s.getChild("odd/@0").getValue());
+  EXPECT_EQ("98",
+            s.getChildrenByName("even").last()->getChild("@0").getValue());
+  EXPECT_EQ(nullptr, s.tryGetChild("none"));
+
+  // Appending children must keep the index up to date.
+  s.appendChild("none", 42, true);
+  EXPECT_EQ("42", s.getChild("none/@0").getValue());
+  EXPECT_EQ(1, s.getChildren("none").count());
+
+  // Removing line breaks shifts all indices.
+  s.removeLineBreaks();
+  EXPECT_EQ("42", s.getChild("none/@0").getValue());
+  EXPECT_EQ("99", s.getChildren("odd").last().getChild("@0").getValue());
+}
+
+TEST(SExpressionTest, testGetChildByPrecompiledPath) {
+  SExpression s = SExpression::parse(
+      "(test (foo (bar 1 2)) (foo (bar 3 4)) (baz))", FilePath());
+  SExpressionPath path("foo/bar/@1");
+  EXPECT_TRUE(path.isValid());
+  EXPECT_EQ("2", s.getChild(path).getValue());
+  EXPECT_EQ(&s.getChild("foo/bar/@1"), &s.getChild(path));
+  EXPECT_EQ(nullptr, s.tryGetChild(SExpressionPath("foo/bar/@2")));
+  EXPECT_EQ(nullptr, s.tryGetChild(SExpressionPath("baz/bar")));
+  EXPECT_FALSE(SExpressionPath("foo/@x").isValid());
+  EXPECT_EQ(nullptr, s.tryGetChild(SExpressionPath("foo/@x")));
+  EXPECT_EQ(nullptr, s.tryGetChild(SExpressionPath("@-1")));
+  EXPECT_THROW(s.getChild(SExpressionPath("foo/baz")), RuntimeError);
+}
+
 TEST(SExpressionTest, testSerializeStringWithEscaping) {
   SExpression s = SExpression::createString("Foo\n \r\n \" \\ Bar");
   EXPECT_EQ("\"Foo\\n \\r\\n \\\" \\\\ Bar\"\n", s.toByteArray());
 }
 
+TEST(SExpressionTest, testSerializeMultiLineList) {
+  SExpression s = SExpression::createList("test");
+  s.appendChild("name", QString::fromUtf8("Foo \xC3\xA4"), true);
+  s.appendChild("size", 5, true);
+  s.appendList("empty", true);
+  EXPECT_EQ("(test\n (name \"Foo \xC3\xA4\")\n (size 5)\n (empty)\n)\n",
+            s.toByteArray());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -721,6 +721,46 @@ TEST_F(TransactionalFileSystemTest, testCheckForModifications) {
   EXPECT_EQ(0, fs.checkForModifications().count());
 }
 
+TEST_F(TransactionalFileSystemTest, testUnchangedFilesAreNotSaved) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  ASSERT_EQ("1", fs.read("1.txt"));
+  fs.write("1.txt", "1");  // same content as on disk
+  fs.write("2.txt", "new 2");  // different content
+  EXPECT_EQ(QStringList{"2.txt"}, fs.checkForModifications());
+
+  // the unchanged file must not be contained in the autosave backup
+  fs.autosave();
+  QByteArray autosave =
+      FileUtils::readFile(mPopulatedDir.getPathTo(".autosave/autosave.lp"));
+  EXPECT_FALSE(autosave.contains("\"1.txt\""));
+  EXPECT_TRUE(autosave.contains("\"2.txt\""));
+
+  fs.save();
+  EXPECT_EQ("1", FileUtils::readFile(fs.getAbsPath("1.txt")));
+  EXPECT_EQ("new 2", FileUtils::readFile(fs.getAbsPath("2.txt")));
+}
+
+TEST_F(TransactionalFileSystemTest, testUnchangedFileInRemovedDirIsSaved) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  ASSERT_EQ("c", fs.read("a/b/c"));
+  fs.removeDirRecursively("a");
+  fs.write("a/b/c", "c");  // same content as on disk before removing the dir
+  fs.save();
+  EXPECT_TRUE(fs.getAbsPath("a/b/c").isExistingFile());
+  EXPECT_EQ("c", FileUtils::readFile(fs.getAbsPath("a/b/c")));
+}
+
+TEST_F(TransactionalFileSystemTest, testCheckForModificationsOnDisk) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  ASSERT_EQ("1", fs.read("1.txt"));
+  fs.write("1.txt", "1");  // same content as on disk
+  EXPECT_EQ(0, fs.checkForModifications().count());
+
+  // modify the file on disk, the remembered hash must not be used anymore
+  FileUtils::writeFile(fs.getAbsPath("1.txt"), "modified on disk");
+  EXPECT_EQ(QStringList{"1.txt"}, fs.checkForModifications());
+}
+
 /*******************************************************************************
  *  Parametrized getSubDirs() Tests
  ******************************************************************************/
@@ -0,0 +1,145 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/levelofdetailpath.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LevelOfDetailPathTest : public ::testing::Test {
+protected:
+  // circle approximated by many short line segments
+  static QPainterPath circle(qreal radius, int segments) noexcept {
+    QPolygonF polygon;
+    for (int i = 0; i <= segments; ++i) {
+      qreal angle = (2 * M_PI * i) / segments;
+      polygon.append(radius * QPointF(std::cos(angle), std::sin(angle)));
+    }
+    QPainterPath path;
+    path.addPolygon(polygon);
+    path.closeSubpath();
+    return path;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LevelOfDetailPathTest, testSimplifyPolylineRemovesCollinearPoints) {
+  QPolygonF polyline;
+  polyline << QPointF(0, 0) << QPointF(1, 0) << QPointF(2, 0.01)
+           << QPointF(3, 0) << QPointF(3, 5);
+  QPolygonF expected;
+  expected << QPointF(0, 0) << QPointF(3, 0) << QPointF(3, 5);
+  EXPECT_EQ(expected, LevelOfDetailPath::simplifyPolyline(polyline, 0.1));
+}
+
+TEST_F(LevelOfDetailPathTest, testSimplifyPolylineKeepsSignificantPoints) {
+  QPolygonF polyline;
+  polyline << QPointF(0, 0) << QPointF(1, 0) << QPointF(2, 0.5)
+           << QPointF(3, 0);
+  QPolygonF expected;
+  expected << QPointF(0, 0) << QPointF(2, 0.5) << QPointF(3, 0);
+  EXPECT_EQ(expected, LevelOfDetailPath::simplifyPolyline(polyline, 0.1));
+}
+
+TEST_F(LevelOfDetailPathTest, testOriginalPathOnHighLevelOfDetail) {
+  QPainterPath path = circle(100, 1000);
+  LevelOfDetailPath lod(path);
+  EXPECT_EQ(path, lod.getSimplifiedPath(100));
+  EXPECT_EQ(path, lod.getSimplifiedPath(qInf()));
+}
+
+TEST_F(LevelOfDetailPathTest, testSimplifiedPathOnLowLevelOfDetail) {
+  QPainterPath path = circle(100, 1000);
+  LevelOfDetailPath lod(path);
+  QPainterPath simplified = lod.getSimplifiedPath(0.1);
+  EXPECT_LT(simplified.elementCount(), path.elementCount() / 10);
+  EXPECT_LT(lod.getSimplifiedPath(0.01).elementCount(),
+            simplified.elementCount());
+  // the deviation must be below a device pixel
+  QRectF rect = path.boundingRect();
+  QRectF simplifiedRect = simplified.boundingRect();
+  EXPECT_NEAR(rect.left(), simplifiedRect.left(), 10);
+  EXPECT_NEAR(rect.right(), simplifiedRect.right(), 10);
+  EXPECT_NEAR(rect.top(), simplifiedRect.top(), 10);
+  EXPECT_NEAR(rect.bottom(), simplifiedRect.bottom(), 10);
+}
+
+TEST_F(LevelOfDetailPathTest, testIsTiny) {
+  LevelOfDetailPath lod(circle(1, 100));
+  EXPECT_FALSE(lod.isTiny(1));
+  EXPECT_TRUE(lod.isTiny(0.1));
+  EXPECT_FALSE(lod.isTiny(qInf()));
+  EXPECT_FALSE(LevelOfDetailPath().isTiny(0.1));
+}
+
+TEST_F(LevelOfDetailPathTest, testSetPathInvalidatesCache) {
+  LevelOfDetailPath lod(circle(100, 1000));
+  QPainterPath simplified = lod.getSimplifiedPath(0.1);
+  lod.setPath(circle(200, 1000));
+  EXPECT_NE(simplified, lod.getSimplifiedPath(0.1));
+  EXPECT_NEAR(400, lod.getSimplifiedPath(0.1).boundingRect().width(), 20);
+}
+
+TEST_F(LevelOfDetailPathTest, testLevelOfDetailOnScreen) {
+  QPixmap pixmap(10, 10);
+  QPainter painter(&pixmap);
+  painter.scale(0.5, 0.5);
+  EXPECT_NEAR(0.5, LevelOfDetailPath::getLevelOfDetail(
+                       painter, QStyleOptionGraphicsItem()),
+              1e-9);
+}
+
+TEST_F(LevelOfDetailPathTest, testNoSimplificationOnExports) {
+  QImage image(10, 10, QImage::Format_ARGB32);
+  QPainter imagePainter(&image);
+  imagePainter.scale(0.5, 0.5);
+  EXPECT_TRUE(qIsInf(LevelOfDetailPath::getLevelOfDetail(
+      imagePainter, QStyleOptionGraphicsItem())));
+
+  QPicture picture;
+  QPainter picturePainter(&picture);
+  picturePainter.scale(0.5, 0.5);
+  EXPECT_TRUE(qIsInf(LevelOfDetailPath::getLevelOfDetail(
+      picturePainter, QStyleOptionGraphicsItem())));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
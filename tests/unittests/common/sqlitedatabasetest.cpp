@@ -96,6 +96,27 @@ TEST_F(SQLiteDatabaseTest, testInsert) {
   }
 }
 
+TEST_F(SQLiteDatabaseTest, testCachedQuery) {
+  SQLiteDatabase db(mTempDbFilePath);
+  db.exec("CREATE TABLE test (`id` INTEGER PRIMARY KEY NOT NULL, `name` TEXT)");
+  QString sql = "INSERT INTO test (name) VALUES (:name)";
+  QSqlQuery& query = db.prepareCachedQuery(sql);
+  EXPECT_EQ(&query, &db.prepareCachedQuery(sql));
+  for (int i = 0; i < 100; ++i) {
+    QSqlQuery& query = db.prepareCachedQuery(sql);
+    query.bindValue(":name", QString("row %1").arg(i));
+    EXPECT_EQ(i + 1, db.insert(query));
+  }
+  QSqlQuery count = db.prepareQuery("SELECT COUNT(*) FROM test");
+  EXPECT_EQ(100, db.count(count));
+}
+
+TEST_F(SQLiteDatabaseTest, testCachedQueryWithInvalidStatement) {
+  SQLiteDatabase db(mTempDbFilePath);
+  EXPECT_THROW(db.prepareCachedQuery("INSERT INTO test (name) VALUES (1)"),
+               Exception);
+}
+
 TEST_F(SQLiteDatabaseTest, testClearExistingTable) {
   SQLiteDatabase db(mTempDbFilePath);
   db.exec("CREATE TABLE test (`id` INTEGER PRIMARY KEY NOT NULL, `name` TEXT)");
@@ -0,0 +1,120 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/elements.h>
+#include <librepcb/library/libraryelementmetadata.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryElementMetadataTest : public ::testing::Test {
+protected:
+  FilePath mTempDir;
+
+  LibraryElementMetadataTest() { mTempDir = FilePath::getRandomTempPath(); }
+
+  virtual ~LibraryElementMetadataTest() {
+    QDir(mTempDir.toStr()).removeRecursively();
+  }
+
+  std::unique_ptr<TransactionalDirectory> saveElement(
+      LibraryBaseElement& element) {
+    std::unique_ptr<TransactionalDirectory> dir(
+        new TransactionalDirectory(TransactionalFileSystem::openRW(
+            mTempDir.getPathTo(element.getUuid().toStr()))));
+    element.saveTo(*dir);
+    return dir;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryElementMetadataTest, testOpenDevice) {
+  Device device(Uuid::createRandom(), Version::fromString("1.2"), "author",
+                ElementName("Foo"), "Bar", "baz", Uuid::createRandom(),
+                Uuid::createRandom());
+  LocalizedNameMap names(ElementName("Foo"));
+  names.insert("de_CH", ElementName("Foo DE"));
+  device.setNames(names);
+  device.setCategories({Uuid::createRandom(), Uuid::createRandom()});
+  std::unique_ptr<TransactionalDirectory> dir = saveElement(device);
+
+  LibraryElementMetadata metadata = LibraryElementMetadata::open<Device>(*dir);
+  EXPECT_EQ(device.getUuid(), metadata.getUuid());
+  EXPECT_EQ(device.getVersion(), metadata.getVersion());
+  EXPECT_EQ(device.getAuthor(), metadata.getAuthor());
+  EXPECT_EQ(device.isDeprecated(), metadata.isDeprecated());
+  EXPECT_EQ(device.getNames(), metadata.getNames());
+  EXPECT_EQ(device.getDescriptions(), metadata.getDescriptions());
+  EXPECT_EQ(device.getKeywords(), metadata.getKeywords());
+  EXPECT_EQ(device.getAllAvailableLocales(),
+            metadata.getAllAvailableLocales());
+  EXPECT_EQ(device.getCategories(), metadata.getCategories());
+  EXPECT_FALSE(metadata.getParentUuid());
+  EXPECT_EQ(device.getComponentUuid(), metadata.getComponentUuid());
+  EXPECT_EQ(device.getPackageUuid(), metadata.getPackageUuid());
+}
+
+TEST_F(LibraryElementMetadataTest, testOpenComponentCategory) {
+  ComponentCategory category(Uuid::createRandom(), Version::fromString("1.0"),
+                             "author", ElementName("Foo"), "", "");
+  category.setParentUuid(Uuid::createRandom());
+  std::unique_ptr<TransactionalDirectory> dir = saveElement(category);
+
+  LibraryElementMetadata metadata =
+      LibraryElementMetadata::open<ComponentCategory>(*dir);
+  EXPECT_EQ(category.getUuid(), metadata.getUuid());
+  EXPECT_EQ(category.getParentUuid(), metadata.getParentUuid());
+  EXPECT_TRUE(metadata.getCategories().isEmpty());
+  EXPECT_FALSE(metadata.getComponentUuid());
+  EXPECT_FALSE(metadata.getPackageUuid());
+}
+
+TEST_F(LibraryElementMetadataTest, testOpenWrongElementType) {
+  Device device(Uuid::createRandom(), Version::fromString("1.0"), "author",
+                ElementName("Foo"), "", "", Uuid::createRandom(),
+                Uuid::createRandom());
+  std::unique_ptr<TransactionalDirectory> dir = saveElement(device);
+  EXPECT_THROW(LibraryElementMetadata::open<Symbol>(*dir), RuntimeError);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
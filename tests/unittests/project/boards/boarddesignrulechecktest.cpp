@@ -0,0 +1,158 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/toolbox.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentaddelements.h>
+#include <librepcb/project/boards/cmd/cmdboardviaedit.h>
+#include <librepcb/project/boards/drc/boarddesignrulecheck.h>
+#include <librepcb/project/boards/items/bi_airwire.h>
+#include <librepcb/project/boards/items/bi_device.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardDesignRuleCheckTest : public ::testing::Test {
+protected:
+  typedef QList<QPair<QString, QVector<Path>>> Messages;
+
+  QScopedPointer<Project> mProject;
+  Board* mBoard;
+
+  BoardDesignRuleCheckTest() : mBoard(nullptr) {
+    // open project from test data directory
+    FilePath projectFp(TEST_DATA_DIR "/projects/Gerber Test/project.lpp");
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    mProject.reset(new Project(std::unique_ptr<TransactionalDirectory>(
+                                   new TransactionalDirectory(projectFs)),
+                               projectFp.getFilename()));
+    mBoard = mProject->getBoards().first();
+    mBoard->rebuildAllPlanes();
+    mBoard->forceAirWiresRebuild();
+  }
+
+  static Messages getMessages(const BoardDesignRuleCheck& drc) {
+    Messages messages;
+    foreach (const BoardDesignRuleCheckMessage& msg, drc.getMessages()) {
+      messages.append(qMakePair(msg.getMessage(), msg.getLocations()));
+    }
+    return messages;
+  }
+
+  Messages runFullCheck() {
+    BoardDesignRuleCheck drc(*mBoard, BoardDesignRuleCheck::Options());
+    drc.execute();
+    return getMessages(drc);
+  }
+
+  static Messages runIncrementalCheck(BoardDesignRuleCheck& drc) {
+    drc.startIncremental();
+    drc.waitForFinished();
+    EXPECT_FALSE(drc.isRunning());
+    return getMessages(drc);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardDesignRuleCheckTest, testIncrementalCheckEqualsFullCheck) {
+  BoardDesignRuleCheck drc(*mBoard, BoardDesignRuleCheck::Options());
+  Messages initialMessages = runFullCheck();
+  EXPECT_EQ(initialMessages, runIncrementalCheck(drc));
+
+  // add a via without net signal on top of a device to get some violations
+  BI_NetSegment* netsegment = new BI_NetSegment(*mBoard, nullptr);
+  mBoard->addNetSegment(*netsegment);
+  CmdBoardNetSegmentAddElements cmdAdd(*netsegment);
+  BI_Via* via = cmdAdd.addVia(
+      Via(Uuid::createRandom(),
+          mBoard->getDeviceInstances().first()->getPosition(),
+          Via::Shape::Round, PositiveLength(1000000), PositiveLength(500000)));
+  cmdAdd.execute();
+  Messages messages = runIncrementalCheck(drc);
+  EXPECT_NE(initialMessages, messages);
+  EXPECT_EQ(runFullCheck(), messages);
+
+  // move the via
+  CmdBoardViaEdit cmdMove(*via);
+  cmdMove.setPosition(via->getPosition() + Point(1000000, 500000), false);
+  cmdMove.execute();
+  EXPECT_EQ(runFullCheck(), runIncrementalCheck(drc));
+
+  // undo all modifications
+  cmdMove.undo();
+  cmdAdd.undo();
+  EXPECT_EQ(initialMessages, runIncrementalCheck(drc));
+}
+
+TEST_F(BoardDesignRuleCheckTest, testRestartWhileRunning) {
+  BoardDesignRuleCheck drc(*mBoard, BoardDesignRuleCheck::Options());
+  drc.startIncremental();
+  drc.startIncremental();  // must run again after the first run
+  drc.waitForFinished();
+  EXPECT_FALSE(drc.isRunning());
+  EXPECT_EQ(runFullCheck(), getMessages(drc));
+}
+
+TEST_F(BoardDesignRuleCheckTest, testBoardIsNotModified) {
+  QList<BI_AirWire*> airWires = mBoard->getAirWires();
+
+  // pending plane rebuilds must not be executed by the DRC
+  mBoard->invalidatePlanes();
+  foreach (BI_Plane* plane, mBoard->getPlanes()) { plane->setFragments({}); }
+  BoardDesignRuleCheck drc(*mBoard, BoardDesignRuleCheck::Options());
+  drc.execute();
+  runIncrementalCheck(drc);
+
+  // airwires must not be rebuilt (i.e. still be the same objects)
+  EXPECT_EQ(Toolbox::toSet(airWires), Toolbox::toSet(mBoard->getAirWires()));
+  foreach (const BI_Plane* plane, mBoard->getPlanes()) {
+    EXPECT_TRUE(plane->getFragments().isEmpty());
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
@@ -54,14 +54,17 @@ namespace tests {
  * this case, just copy the files from "actual" to "expected", check the diff
  * with Git (i.e. verify if the diff is as expected and makes sense) and then
  * commit those changes.
+ *
+ * The test is run with different numbers of parallel jobs to make sure the
+ * output does not depend on it.
  */
-class BoardGerberExportTest : public ::testing::Test {};
+class BoardGerberExportTest : public ::testing::TestWithParam<int> {};
 
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
 
-TEST(BoardGerberExportTest, test) {
+TEST_P(BoardGerberExportTest, test) {
   FilePath testDataDir(TEST_DATA_DIR
                        "/unittests/librepcbproject/BoardGerberExportTest");
 
@@ -83,7 +86,7 @@ TEST(BoardGerberExportTest, test) {
   config.setOutputBasePath(testDataDir.getPathTo("actual").toStr() %
                            "/{{PROJECT}}");
   BoardGerberExport grbExport(*board, config);
-  grbExport.exportAllLayers();
+  grbExport.exportAllLayers(GetParam());
 
   // replace volatile data in exported files with well-known, constant data
   foreach (const FilePath& fp, grbExport.getWrittenFiles()) {
@@ -117,6 +120,13 @@ TEST(BoardGerberExportTest, test) {
   }
 }
 
+/*******************************************************************************
+ *  Test Data
+ ******************************************************************************/
+
+INSTANTIATE_TEST_SUITE_P(BoardGerberExportTest, BoardGerberExportTest,
+                         ::testing::Values(1, 4));
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -25,7 +25,11 @@
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentaddelements.h>
+#include <librepcb/project/boards/cmd/cmdboardviaedit.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
 #include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/boards/items/bi_via.h>
 #include <librepcb/project/project.h>
 
 #include <QtCore>
@@ -49,13 +53,32 @@ namespace tests {
  * with the expected paths of all plane fragments. This test then re-calculates
  * all plane fragments and compares them with the expected fragments.
  */
-class BoardPlaneFragmentsBuilderTest : public ::testing::Test {};
+class BoardPlaneFragmentsBuilderTest : public ::testing::Test {
+protected:
+  static QMap<Uuid, QVector<Path>> getFragments(const Board& board) {
+    QMap<Uuid, QVector<Path>> fragments;
+    foreach (const BI_Plane* plane, board.getPlanes()) {
+      fragments.insert(plane->getUuid(), plane->getFragments());
+    }
+    return fragments;
+  }
+
+  static QMap<Uuid, QVector<Path>> getFragmentsOfFullRebuild(Board& board) {
+    QMap<Uuid, QVector<Path>> current = getFragments(board);
+    board.rebuildAllPlanes();
+    QMap<Uuid, QVector<Path>> rebuilt = getFragments(board);
+    foreach (BI_Plane* plane, board.getPlanes()) {
+      plane->setFragments(current.value(plane->getUuid()));  // restore
+    }
+    return rebuilt;
+  }
+};
 
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
 
-TEST(BoardPlaneFragmentsBuilderTest, testFragments) {
+TEST_F(BoardPlaneFragmentsBuilderTest, testFragments) {
   FilePath testDataDir(
       TEST_DATA_DIR
       "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest");
@@ -112,6 +135,82 @@ TEST(BoardPlaneFragmentsBuilderTest, testFragments) {
   EXPECT_EQ(expectedPlaneFragments, actualPlaneFragments);
 }
 
+TEST_F(BoardPlaneFragmentsBuilderTest, testRebuildInvalidatedPlanes) {
+  // open project from test data directory
+  FilePath projectFp(TEST_DATA_DIR "/projects/Nested Planes/project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());
+  QScopedPointer<Project> project(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));
+  Board* board = project->getBoards().first();
+  ASSERT_FALSE(board->getPlanes().isEmpty());
+  board->rebuildAllPlanes();
+  QMap<Uuid, QVector<Path>> initialFragments = getFragments(*board);
+
+  // add a via without net signal in the middle of a plane
+  QPointF center = board->getPlanes().first()->getOutline()
+                       .toQPainterPathPx()
+                       .boundingRect()
+                       .center();
+  BI_NetSegment* netsegment = new BI_NetSegment(*board, nullptr);
+  board->addNetSegment(*netsegment);
+  CmdBoardNetSegmentAddElements cmdAdd(*netsegment);
+  BI_Via* via = cmdAdd.addVia(
+      Via(Uuid::createRandom(), Point::fromPx(center.x(), center.y()),
+          Via::Shape::Round, PositiveLength(1000000), PositiveLength(500000)));
+  cmdAdd.execute();
+  board->rebuildInvalidatedPlanes();
+  EXPECT_NE(initialFragments, getFragments(*board));
+  EXPECT_EQ(getFragmentsOfFullRebuild(*board), getFragments(*board));
+
+  // move the via
+  CmdBoardViaEdit cmdMove(*via);
+  cmdMove.setPosition(via->getPosition() + Point(2000000, 1000000), false);
+  cmdMove.execute();
+  board->rebuildInvalidatedPlanes();
+  EXPECT_EQ(getFragmentsOfFullRebuild(*board), getFragments(*board));
+
+  // undo all modifications
+  cmdMove.undo();
+  cmdAdd.undo();
+  board->rebuildInvalidatedPlanes();
+  EXPECT_EQ(initialFragments, getFragments(*board));
+}
+
+TEST_F(BoardPlaneFragmentsBuilderTest, testRebuildOnlyAffectedPlanes) {
+  // open project from test data directory
+  FilePath projectFp(TEST_DATA_DIR "/projects/Nested Planes/project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());
+  QScopedPointer<Project> project(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));
+  Board* board = project->getBoards().first();
+  ASSERT_FALSE(board->getPlanes().isEmpty());
+  board->rebuildAllPlanes();
+  QMap<Uuid, QVector<Path>> expectedFragments = getFragments(*board);
+
+  // clear all fragments to see which planes are rebuilt
+  foreach (BI_Plane* plane, board->getPlanes()) { plane->setFragments({}); }
+
+  // an area far away from all planes must not rebuild any plane
+  board->invalidatePlanes(QRectF(1e6, 1e6, 10, 10));
+  board->rebuildInvalidatedPlanes();
+  foreach (const BI_Plane* plane, board->getPlanes()) {
+    EXPECT_TRUE(plane->getFragments().isEmpty());
+  }
+
+  // an area within a plane must rebuild it (with the same result as before)
+  const BI_Plane* plane = board->getPlanes().first();
+  QRectF area = plane->getOutline().toQPainterPathPx().boundingRect();
+  board->invalidatePlanes(QRectF(area.center(), QSizeF(1, 1)));
+  board->rebuildInvalidatedPlanes();
+  EXPECT_EQ(expectedFragments.value(plane->getUuid()), plane->getFragments());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
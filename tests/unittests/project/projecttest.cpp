@@ -22,6 +22,14 @@
  ******************************************************************************/
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/gridproperties.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentadd.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentaddelements.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/circuit/circuit.h>
 #include <librepcb/project/metadata/projectmetadata.h>
 #include <librepcb/project/project.h>
 
@@ -191,6 +199,77 @@ TEST_F(ProjectTest, testSettersGetters) {
   EXPECT_EQ(version, project->getMetadata().getVersion());
 }
 
+TEST_F(ProjectTest, testOnlyModifiedBoardsAreSaved) {
+  QScopedPointer<Project> project(
+      Project::create(createDir(), mProjectFile.getFilename()));
+  Board* board1 = project->createBoard(ElementName("Board 1"));
+  project->addBoard(*board1);
+  Board* board2 = project->createBoard(ElementName("Board 2"));
+  project->addBoard(*board2);
+  EXPECT_TRUE(board1->isDirty());
+  EXPECT_TRUE(board2->isDirty());
+
+  // save project
+  project->save();
+  EXPECT_FALSE(board1->isDirty());
+  EXPECT_FALSE(board2->isDirty());
+  EXPECT_FALSE(project->getCircuit().isDirty());
+
+  // modify only one board
+  board2->setGridProperties(GridProperties());
+  EXPECT_FALSE(board1->isDirty());
+  EXPECT_TRUE(board2->isDirty());
+
+  // save project again
+  project->save();
+  EXPECT_FALSE(board1->isDirty());
+  EXPECT_FALSE(board2->isDirty());
+}
+
+TEST_F(ProjectTest, testSaveInMiddleOfCommandGroup) {
+  QScopedPointer<Project> project(
+      Project::create(createDir(), mProjectFile.getFilename()));
+  Board* board = project->createBoard(ElementName("Board 1"));
+  project->addBoard(*board);
+
+  // add a via within a command group, like the "draw trace" tool does
+  UndoStack undoStack;
+  undoStack.beginCmdGroup("Add Via");
+  CmdBoardNetSegmentAdd* cmdAddSegment =
+      new CmdBoardNetSegmentAdd(*board, nullptr);
+  undoStack.appendToCmdGroup(cmdAddSegment);
+  CmdBoardNetSegmentAddElements* cmdAddVia =
+      new CmdBoardNetSegmentAddElements(*cmdAddSegment->getNetSegment());
+  BI_Via* via = cmdAddVia->addVia(Via(Uuid::createRandom(), Point(0, 0),
+                                      Via::Shape::Round, PositiveLength(700000),
+                                      PositiveLength(300000)));
+  undoStack.appendToCmdGroup(cmdAddVia);
+
+  // save project while the command group is still active
+  project->save();
+  EXPECT_FALSE(board->isDirty());
+
+  // tools modify items directly without undo commands until the command group
+  // gets committed, so the board must get dirty anyway
+  via->setPosition(Point(1000000, 2000000));
+  EXPECT_TRUE(board->isDirty());
+  undoStack.commitCmdGroup();
+  EXPECT_TRUE(board->isDirty());
+
+  // the next save must write the modification
+  project->save();
+  EXPECT_FALSE(board->isDirty());
+  project->getDirectory().getFileSystem()->save();
+  project.reset();
+  project.reset(new Project(createDir(), mProjectFile.getFilename()));
+  ASSERT_EQ(1, project->getBoards().count());
+  board = project->getBoards().first();
+  ASSERT_EQ(1, board->getNetSegments().count());
+  BI_NetSegment* segment = board->getNetSegments().first();
+  ASSERT_EQ(1, segment->getVias().count());
+  EXPECT_EQ(Point(1000000, 2000000), segment->getVias().first()->getPosition());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
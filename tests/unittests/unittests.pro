@@ -73,6 +73,7 @@ isEmpty(UNBUNDLE) {
 
 SOURCES += \
     common/algorithm/airwiresbuildertest.cpp \
+    common/algorithm/polygonindextest.cpp \
     common/alignmenttest.cpp \
     common/applicationtest.cpp \
     common/attributes/attributekeytest.cpp \
@@ -81,6 +82,8 @@ SOURCES += \
     common/attributes/attributetypetest.cpp \
     common/attributes/attributeunittest.cpp \
     common/boarddesignrulestest.cpp \
+    common/cam/gerberaperturelisttest.cpp \
+    common/cam/gerbergeneratortest.cpp \
     common/circuitidentifiertest.cpp \
     common/fileio/csvfiletest.cpp \
     common/fileio/directorylocktest.cpp \
@@ -98,6 +101,7 @@ SOURCES += \
     common/geometry/vertextest.cpp \
     common/geometry/viatest.cpp \
     common/graphics/graphicslayernametest.cpp \
+    common/graphics/levelofdetailpathtest.cpp \
     common/network/filedownloadtest.cpp \
     common/network/networkrequesttest.cpp \
     common/pnp/pickplacecsvwritertest.cpp \
@@ -127,12 +131,14 @@ SOURCES += \
     library/cmp/componentsymbolvariantitemsuffixtest.cpp \
     library/cmp/componentsymbolvariantitemtest.cpp \
     library/librarybaseelementtest.cpp \
+    library/libraryelementmetadatatest.cpp \
     library/pkg/footprintpadtest.cpp \
     library/sym/symbolpintest.cpp \
     libraryeditor/pkg/footprintclipboarddatatest.cpp \
     libraryeditor/sym/symbolclipboarddatatest.cpp \
     librarymanager/librarydownloadtest.cpp \
     main.cpp \
+    project/boards/boarddesignrulechecktest.cpp \
     project/boards/boardfabricationoutputsettingstest.cpp \
     project/boards/boardgerberexporttest.cpp \
     project/boards/boardpickplacegeneratortest.cpp \
@@ -141,6 +147,7 @@ SOURCES += \
     project/projecttest.cpp \
     projecteditor/boardeditor/boardclipboarddatatest.cpp \
     projecteditor/schematiceditor/schematicclipboarddatatest.cpp \
+    workspace/library/workspacelibrarydbtest.cpp \
     workspace/settings/workspacesettingstest.cpp \
     workspace/workspacetest.cpp \
 
@@ -0,0 +1,151 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/sqlitedatabase.h>
+#include <librepcb/common/toolbox.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/workspace.h>
+
+#include <QtCore>
+#include <QtSql>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class WorkspaceLibraryDbTest : public ::testing::Test {
+protected:
+  FilePath mWsDir;
+  QScopedPointer<Workspace> mWs;
+  QScopedPointer<SQLiteDatabase> mDb;  ///< to fill the database directly
+
+  WorkspaceLibraryDbTest() {
+    mWsDir = FilePath::getRandomTempPath().getPathTo("test workspace dir");
+    Workspace::createNewWorkspace(mWsDir);
+    mWs.reset(new Workspace(mWsDir));
+    mDb.reset(new SQLiteDatabase(mWs->getLibraryDb().getFilePath()));
+  }
+
+  virtual ~WorkspaceLibraryDbTest() {
+    mDb.reset();
+    mWs.reset();
+    QDir(mWsDir.getParentDir().toStr()).removeRecursively();
+  }
+
+  Uuid addSymbol(const QString& name, const QString& keywords) {
+    Uuid uuid = Uuid::createRandom();
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT INTO symbols "
+        "(lib_id, filepath, fingerprint, uuid, version) VALUES "
+        "(0, :filepath, '', :uuid, '0.1')");
+    query.bindValue(":filepath", uuid.toStr());
+    query.bindValue(":uuid", uuid.toStr());
+    int id = mDb->insert(query);
+    query = mDb->prepareQuery(
+        "INSERT INTO symbols_tr "
+        "(symbol_id, locale, name, description, keywords) VALUES "
+        "(:symbol_id, '', :name, '', :keywords)");
+    query.bindValue(":symbol_id", id);
+    query.bindValue(":name", name);
+    query.bindValue(":keywords", keywords);
+    mDb->insert(query);
+    return uuid;
+  }
+
+  QList<Uuid> search(const QString& keyword, int limit = -1,
+                     int offset = 0) const {
+    return mWs->getLibraryDb().getElementsBySearchKeyword<library::Symbol>(
+        keyword, limit, offset);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testBuildFullTextSearchQuery) {
+  EXPECT_EQ("", WorkspaceLibraryDb::buildFullTextSearchQuery(""));
+  EXPECT_EQ("", WorkspaceLibraryDb::buildFullTextSearchQuery(" \t "));
+  EXPECT_EQ("\"res\"*", WorkspaceLibraryDb::buildFullTextSearchQuery("res"));
+  EXPECT_EQ("\"res\"* \"0805\"*",
+            WorkspaceLibraryDb::buildFullTextSearchQuery("  res 0805 "));
+  EXPECT_EQ("\"a\"\"b\"*",
+            WorkspaceLibraryDb::buildFullTextSearchQuery("a\"b"));
+  EXPECT_EQ("\"NOT\"* \"(x*\"*",
+            WorkspaceLibraryDb::buildFullTextSearchQuery("NOT (x*"));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testSearchByNameAndKeywords) {
+  Uuid resistor = addSymbol("Resistor", "r,smd");
+  Uuid capacitor = addSymbol("Capacitor", "c,resonator");
+  addSymbol("Diode", "d");
+  EXPECT_EQ(QList<Uuid>{resistor}, search("resistor"));
+  EXPECT_EQ(QList<Uuid>{resistor}, search("SMD"));
+  EXPECT_EQ(QSet<Uuid>({resistor, capacitor}), Toolbox::toSet(search("res")));
+  EXPECT_EQ(QList<Uuid>{}, search("transistor"));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testSearchWithMultipleTerms) {
+  Uuid resistor0805 = addSymbol("Resistor 0805", "");
+  addSymbol("Resistor 0603", "");
+  EXPECT_EQ(QList<Uuid>{resistor0805}, search("res 0805"));
+  EXPECT_EQ(QList<Uuid>{resistor0805}, search("0805 resistor"));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testSearchWithSpecialCharacters) {
+  // FTS5 operators and special characters must not lead to syntax errors
+  Uuid resistor = addSymbol("Resistor", "");
+  EXPECT_EQ(QList<Uuid>{}, search("\""));
+  EXPECT_EQ(QList<Uuid>{}, search("*"));
+  EXPECT_EQ(QList<Uuid>{}, search("res NOT"));
+  EXPECT_EQ(QList<Uuid>{resistor}, search("(res"));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testSearchLimitAndOffset) {
+  QSet<Uuid> uuids;
+  for (int i = 0; i < 5; ++i) {
+    uuids.insert(addSymbol(QString("Resistor %1").arg(i), ""));
+  }
+  EXPECT_EQ(5, search("res").count());
+  EXPECT_EQ(2, search("res", 2).count());
+  QList<Uuid> all = search("res");
+  EXPECT_EQ(uuids, Toolbox::toSet(all));
+  EXPECT_EQ(all.mid(3), search("res", -1, 3));
+  EXPECT_EQ(all.mid(1, 2), search("res", 2, 1));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace workspace
+}  // namespace librepcb